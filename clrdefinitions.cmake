@@ -104,6 +104,8 @@ endif(WIN32)
 add_definitions(-DFEATURE_CODE_VERSIONING)
 add_definitions(-DFEATURE_COLLECTIBLE_TYPES)
 
+# COM and WinRT interop is already compiled out of non-Windows builds. The remaining marshaling code
+# (mlinfo, fieldmarshaler, ilmarshalers) backs P/Invoke and struct layout and cannot be removed.
 if(WIN32)
     add_definitions(-DFEATURE_CLASSIC_COMINTEROP)
     add_definitions(-DFEATURE_COMINTEROP)
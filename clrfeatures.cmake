@@ -16,6 +16,8 @@ if(NOT DEFINED FEATURE_DBGIPC)
   endif()
 endif(NOT DEFINED FEATURE_DBGIPC)
 
+# The interpreter already hands methods to tiered compilation once they exceed
+# InterpreterJITThreshold calls, but it only covers a subset of IL and targets, so it stays opt-in.
 if(NOT DEFINED FEATURE_INTERPRETER)
   set(FEATURE_INTERPRETER 0)
 endif(NOT DEFINED FEATURE_INTERPRETER)
@@ -12,4 +12,17 @@ if(NOT WIN32)
   check_have_lto()
 
   check_cxx_compiler_flag(-faligned-new COMPILER_SUPPORTS_F_ALIGNED_NEW)
+
+  # The outline atomics helpers live in libgcc (or compiler-rt), so make sure a
+  # read-modify-write atomic built with the flag also links.
+  function(check_have_outline_atomics)
+    set(CMAKE_REQUIRED_FLAGS -moutline-atomics)
+    check_cxx_source_compiles("
+      int main()
+      {
+        static long value = 0;
+        return (int)__atomic_fetch_add(&value, 1, __ATOMIC_SEQ_CST);
+      }" COMPILER_SUPPORTS_MOUTLINE_ATOMICS)
+  endfunction(check_have_outline_atomics)
+  check_have_outline_atomics()
 endif(NOT WIN32)
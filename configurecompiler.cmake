@@ -544,6 +544,16 @@ if(CLR_CMAKE_PLATFORM_UNIX_ARM)
    endif(ARM_SOFTFP)
 endif(CLR_CMAKE_PLATFORM_UNIX_ARM)
 
+if(CLR_CMAKE_PLATFORM_UNIX_ARM64)
+  # Compile the runtime's own atomic operations (the __sync/__atomic builtins behind the Interlocked
+  # helpers) as calls to helpers that pick ARMv8.1 LSE instructions at run time when the processor
+  # supports them, and fall back to LL/SC loops otherwise. JIT-emitted interlocked operations check
+  # for LSE separately, through CORJIT_FLAG_HAS_ARM64_ATOMICS.
+  if(COMPILER_SUPPORTS_MOUTLINE_ATOMICS)
+    add_compile_options(-moutline-atomics)
+  endif(COMPILER_SUPPORTS_MOUTLINE_ATOMICS)
+endif(CLR_CMAKE_PLATFORM_UNIX_ARM64)
+
 if(CLR_CMAKE_PLATFORM_UNIX)
   add_compile_options(${CLR_ADDITIONAL_COMPILER_OPTIONS})
 endif(CLR_CMAKE_PLATFORM_UNIX)
@@ -287,13 +287,14 @@ namespace BINDER_SPACE
             SString simpleName;
             bool isNativeImage = false;
 
-            // GCC complains if we create SStrings inline as part of a function call
-            SString sNiDll(W(".ni.dll"));
-            SString sNiExe(W(".ni.exe"));
-            SString sNiWinmd(W(".ni.winmd"));
-            SString sDll(W(".dll"));
-            SString sExe(W(".exe"));
-            SString sWinmd(W(".winmd"));
+            // GCC complains if we create SStrings inline as part of a function call.
+            // Wrap the literals without copying them, since this runs for every TPA entry.
+            SString sNiDll(SString::Literal, W(".ni.dll"));
+            SString sNiExe(SString::Literal, W(".ni.exe"));
+            SString sNiWinmd(SString::Literal, W(".ni.winmd"));
+            SString sDll(SString::Literal, W(".dll"));
+            SString sExe(SString::Literal, W(".exe"));
+            SString sWinmd(SString::Literal, W(".winmd"));
             
             if (fileName.EndsWithCaseInsensitive(sNiDll) ||
                 fileName.EndsWithCaseInsensitive(sNiExe))
@@ -1243,7 +1243,7 @@ namespace BINDER_SPACE
         {
             ReleaseHolder<Assembly> pAssembly;
             SString &wszBindingPath = (*pResourceRoots)[i];
-            SString fileName(wszBindingPath);
+            PathString fileName(wszBindingPath);
 
             CombinePath(fileName, cultureRef, fileName);
             CombinePath(fileName, simpleNameRef, fileName);
@@ -1354,7 +1354,7 @@ namespace BINDER_SPACE
             {
                 if (pTpaEntry->m_wszNIFileName != nullptr)
                 {
-                    SString fileName(pTpaEntry->m_wszNIFileName);
+                    PathString fileName(pTpaEntry->m_wszNIFileName);
 
                     // A GetAssembly overload perhaps, or just another parameter to the existing method
                     hr = GetAssembly(fileName,
@@ -1367,7 +1367,7 @@ namespace BINDER_SPACE
                 else
                 {
                     _ASSERTE(pTpaEntry->m_wszILFileName != nullptr);
-                    SString fileName(pTpaEntry->m_wszILFileName);
+                    PathString fileName(pTpaEntry->m_wszILFileName);
                     
                     hr = GetAssembly(fileName,
                                         fInspectionOnly,
@@ -1419,7 +1419,7 @@ namespace BINDER_SPACE
                         hr = HRESULT_FROM_WIN32(ERROR_FILE_NOT_FOUND);
 
                         {
-                            SString fileName(wszBindingPath);
+                            PathString fileName(wszBindingPath);
                             CombinePath(fileName, simpleName, fileName);
                             if (parseAppNiPaths)
                             {
@@ -1447,7 +1447,7 @@ namespace BINDER_SPACE
 
                         if (FAILED(hr))
                         {
-                            SString fileName(wszBindingPath);
+                            PathString fileName(wszBindingPath);
                             CombinePath(fileName, simpleName, fileName);
 
                             if (parseAppNiPaths)
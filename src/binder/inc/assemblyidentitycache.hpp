@@ -10,6 +10,10 @@
 //
 // Defines the AssemblyIdentityCache class and its helpers
 //
+// The cache only lives for the process. The identity of a bound assembly is read from the
+// metadata of the image that is opened and mapped anyway to load it, so persisting bind
+// results across runs would save only the parse, and would still need the file itself.
+//
 // ============================================================
 
 #ifndef __BINDER__ASSEMBLY_IDENTITY_CACHE_HPP__
@@ -505,7 +505,7 @@ namespace BINDER_SPACE
     {
         BOOL fIsValid = TRUE;
         BINDER_LOG_ENTER(W("TextualIdentityParser::Parse(textualIdentity)"));
-        SString unicodeTextualIdentity;
+        StackSString unicodeTextualIdentity;
 
         // Lexer modifies input string
         textualIdentity.ConvertToUnicode(unicodeTextualIdentity);
@@ -546,7 +546,7 @@ namespace BINDER_SPACE
     {
         BOOL fIsValid = TRUE;
         BINDER_LOG_ENTER(W("TextualIdentityParser::ParseString"));
-        SString unicodeTextualString;
+        StackSString unicodeTextualString;
 
         // Lexer modifies input string
         textualString.ConvertToUnicode(unicodeTextualString);
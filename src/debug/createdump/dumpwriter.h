@@ -34,7 +34,9 @@ private:
     LONG m_ref;                         // reference count
     int m_fd;
     CrashInfo& m_crashInfo;
-    BYTE m_tempBuffer[0x4000];
+    // Memory regions are copied through this buffer; large reads keep the number of
+    // /proc/pid/mem reads and core file writes per region low.
+    BYTE m_tempBuffer[0x100000];
 
 public:
     DumpWriter(CrashInfo& crashInfo);
@@ -6173,13 +6173,22 @@ HeapData::~HeapData()
 }
 
 LinearReadCache::LinearReadCache()
-    : mCurrPageStart(0), mPageSize(0), mCurrPageSize(0), mPage(0)
+    : mCurrPageStart(0), mPageSize(0), mWindowSize(0), mCurrPageSize(0), mPage(0)
 {
     SYSTEM_INFO si;
 	GetSystemInfo(&si);
 
     mPageSize = si.dwPageSize;
-    mPage = new (nothrow) BYTE[mPageSize];
+
+    // Heap walks read the target linearly, so cache several pages per read to cut down
+    // on round trips to the data target, which dominate walks over large dumps.
+    mWindowSize = mPageSize * WindowPages;
+    mPage = new (nothrow) BYTE[mWindowSize];
+    if (mPage == NULL)
+    {
+        mWindowSize = mPageSize;
+        mPage = new (nothrow) BYTE[mWindowSize];
+    }
 }
 
 LinearReadCache::~LinearReadCache()
@@ -6190,8 +6199,16 @@ LinearReadCache::~LinearReadCache()
 
 bool LinearReadCache::MoveToPage(CORDB_ADDRESS addr)
 {
-    mCurrPageStart = addr - (addr % mPageSize);
-    HRESULT hr = g_dacImpl->m_pTarget->ReadVirtual(mCurrPageStart, mPage, mPageSize, &mCurrPageSize);
+    mCurrPageStart = addr - (addr % mWindowSize);
+    HRESULT hr = g_dacImpl->m_pTarget->ReadVirtual(mCurrPageStart, mPage, mWindowSize, &mCurrPageSize);
+
+    // The whole window may not be readable (e.g. only part of it was captured in the dump),
+    // in which case fall back to just the page containing addr.
+    if ((hr != S_OK || addr - mCurrPageStart >= mCurrPageSize) && mWindowSize != mPageSize)
+    {
+        mCurrPageStart = addr - (addr % mPageSize);
+        hr = g_dacImpl->m_pTarget->ReadVirtual(mCurrPageStart, mPage, mPageSize, &mCurrPageSize);
+    }
 
     if (hr != S_OK)
     {
@@ -6210,6 +6227,7 @@ CORDB_ADDRESS DacHeapWalker::HeapEnd = ~0;
 DacHeapWalker::DacHeapWalker()
     : mThreadCount(0), mAllocInfo(0), mHeapCount(0), mHeaps(0),
         mCurrObj(0), mCurrSize(0), mCurrMT(0),
+        mLastMT(0), mLastBaseSize(0), mLastComponentSize(0),
         mCurrHeap(0), mCurrSeg(0), mStart((TADDR)HeapStart), mEnd((TADDR)HeapEnd)
 {
 }
@@ -6293,8 +6311,17 @@ bool DacHeapWalker::GetSize(TADDR tMT, size_t &size)
     bool ret = true;
     EX_TRY
     {
-        MethodTable *mt = PTR_MethodTable(tMT);
-        size_t cs = mt->GetComponentSize();
+        // Runs of objects of the same type are common, so remember the sizes of the last
+        // MethodTable rather than going through the DAC instance cache for every object.
+        if (tMT != mLastMT)
+        {
+            MethodTable *mt = PTR_MethodTable(tMT);
+            mLastComponentSize = mt->GetComponentSize();
+            mLastBaseSize = mt->GetBaseSize();
+            mLastMT = tMT;
+        }
+
+        size_t cs = mLastComponentSize;
 
         if (cs)
         {
@@ -6305,7 +6332,7 @@ bool DacHeapWalker::GetSize(TADDR tMT, size_t &size)
                 ret = false;
         }
 
-        size = mt->GetBaseSize() + cs;
+        size = mLastBaseSize + cs;
 
         // The size is not guaranteed to be aligned, we have to
         // do that ourself.
@@ -1687,8 +1687,10 @@ private:
     }
 
 private:
+    static const ULONG32 WindowPages = 16;
+
     CORDB_ADDRESS mCurrPageStart;
-    ULONG32 mPageSize, mCurrPageSize;
+    ULONG32 mPageSize, mWindowSize, mCurrPageSize;
     BYTE *mPage;
 };
 
@@ -1797,6 +1799,10 @@ private:
     size_t mCurrSize;
     TADDR mCurrMT;
 
+    TADDR mLastMT;
+    size_t mLastBaseSize;
+    size_t mLastComponentSize;
+
     size_t mCurrHeap;
     size_t mCurrSeg;
 
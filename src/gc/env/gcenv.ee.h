@@ -91,6 +91,9 @@ public:
 
     static void VerifySyncTableEntry();
     static void UpdateGCEventStatus(int publicLevel, int publicKeywords, int privateLevel, int privateKeywords);
+
+    static uint32_t GetCapabilityVersion(GCToEECapability capability);
+    static bool GetNumaTopology(uint16_t* highestNode);
 };
 
 #endif // __GCENV_EE_H__
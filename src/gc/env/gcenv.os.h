@@ -443,6 +443,14 @@ public:
     //  Any parameter can be null.
     static void GetMemoryStatus(uint32_t* memory_load, uint64_t* available_physical, uint64_t* available_page_file);
 
+    // Get the memory pressure stall information
+    // Parameters:
+    //  pressure - A number between 0 and 100, the percentage of the last few seconds during which
+    //      some threads of the process' cgroup were stalled waiting for memory.
+    // Return:
+    //  true if the OS reports it, false otherwise.
+    static bool GetMemoryPressure(uint32_t* pressure);
+
     // Get size of an OS memory page
     static size_t GetPageSize();
 
@@ -445,6 +445,9 @@ gc_mechanisms_store gc_heap::gchist[max_history_count];
 #ifndef MULTIPLE_HEAPS
 size_t gc_heap::total_promoted_bytes = 0;
 VOLATILE(bgc_state) gc_heap::current_bgc_state = bgc_not_in_process;
+#ifdef BACKGROUND_GC
+VOLATILE(bool) gc_heap::loh_sweep_concurrent_p = false;
+#endif //BACKGROUND_GC
 int gc_heap::gchist_index_per_heap = 0;
 gc_heap::gc_history gc_heap::gchist_per_heap[max_history_count];
 #endif //MULTIPLE_HEAPS
@@ -1548,6 +1551,9 @@ __asm   pop     EDX
 #endif //COUNT_CYCLES
 
 #ifdef TIME_GC
+// Note these are process-wide rather than per heap; with server GC each heap's thread
+// overwrites them, so they only describe the phase durations of whichever heap stored last.
+// Per-heap mark stealing counts are collected separately under SNOOP_STATS.
 int mark_time, plan_time, sweep_time, reloc_time, compact_time;
 #endif //TIME_GC
 
@@ -2215,6 +2221,13 @@ const int max_snoop_level = 128;
 
 #define GC_EPHEMERAL_DECOMMIT_TIMEOUT 5000
 
+#ifdef MULTIPLE_HEAPS
+// How often heap 0's GC thread does a gradual decommit step, and how much each heap
+// decommits per step.
+#define DECOMMIT_TIME_STEP_MILLISECONDS (100)
+#define DECOMMIT_SIZE_PER_STEP (16*1024*1024)
+#endif //MULTIPLE_HEAPS
+
 inline
 size_t align_on_page (size_t add)
 {
@@ -2421,6 +2434,8 @@ uint8_t**   gc_heap::g_mark_list_copy;
 #endif //PARALLEL_MARK_LIST_SORT
 
 size_t      gc_heap::mark_list_size;
+size_t      gc_heap::max_mark_list_size;
+BOOL        gc_heap::mark_list_overflow;
 #endif //MARK_LIST
 
 #ifdef SEG_MAPPING_TABLE
@@ -2446,6 +2461,16 @@ uintptr_t   process_mask = 0;
 
 int         gc_heap::n_heaps;
 
+int         gc_heap::n_active_heaps;
+
+bool        gc_heap::dynamic_heap_count_p = false;
+
+size_t      gc_heap::dynamic_heap_count_start_time = 0;
+
+size_t      gc_heap::dynamic_heap_count_gc_time = 0;
+
+size_t      gc_heap::dynamic_heap_count_gc_count = 0;
+
 gc_heap**   gc_heap::g_heaps;
 
 size_t*     gc_heap::g_promoted;
@@ -2457,8 +2482,14 @@ int*        gc_heap::g_mark_stack_busy;
 
 #ifdef BACKGROUND_GC
 size_t*     gc_heap::g_bpromoted;
+
+VOLATILE(int32_t) gc_heap::bgc_idle_thread_count = 0;
 #endif //BACKGROUND_GC
 
+#ifdef CARD_MARKING_STEALING
+BOOL        gc_heap::card_marking_stealing_p = FALSE;
+#endif //CARD_MARKING_STEALING
+
 #else  //MULTIPLE_HEAPS
 
 size_t      gc_heap::g_promoted;
@@ -2522,12 +2553,38 @@ uint32_t    gc_heap::m_high_memory_load_th;
 
 uint32_t    gc_heap::v_high_memory_load_th;
 
+uint32_t    gc_heap::memory_pressure_stall_th = 0;
+
+#ifdef MULTIPLE_HEAPS
+bool        gc_heap::gradual_decommit_p = false;
+
+bool        gc_heap::gradual_decommit_in_progress_p = false;
+#endif //MULTIPLE_HEAPS
+
 uint64_t    gc_heap::total_physical_mem = 0;
 
 uint64_t    gc_heap::entry_available_physical_mem = 0;
 
 size_t      gc_heap::heap_hard_limit = 0;
 
+size_t      gc_heap::heap_hard_limit_oh[total_oh_count] = {0, 0};
+
+size_t      gc_heap::committed_by_oh[total_oh_count] = {0, 0};
+
+int         gc_heap::conserve_mem_frag_target = 0;
+
+size_t      gc_heap::pause_target_ms = 0;
+
+size_t      gc_heap::pause_target_miss_count = 0;
+
+int         gc_heap::pause_target_budget_pct = 100;
+
+int         gc_heap::alloc_quantum_max_shift = 0;
+
+#ifdef BACKGROUND_GC
+bool        gc_heap::concurrent_loh_sweep_p = true;
+#endif //BACKGROUND_GC
+
 #ifdef BACKGROUND_GC
 GCEvent     gc_heap::bgc_start_event;
 
@@ -2824,12 +2881,18 @@ GCSpinLock gc_heap::gc_lock;
 size_t gc_heap::eph_gen_starts_size = 0;
 heap_segment* gc_heap::segment_standby_list;
 bool          gc_heap::use_large_pages_p = 0;
+
+bool          gc_heap::bookkeeping_large_pages_p = false;
+bool          gc_heap::bookkeeping_large_pages_used_p = false;
+uint32_t*     gc_heap::bookkeeping_new_card_table = 0;
 size_t        gc_heap::last_gc_index = 0;
 #ifdef SEG_MAPPING_TABLE
 size_t        gc_heap::min_segment_size = 0;
 size_t        gc_heap::min_segment_size_shr = 0;
 #endif //SEG_MAPPING_TABLE
 size_t        gc_heap::soh_segment_size = 0;
+
+size_t        gc_heap::soh_region_size = 0;
 size_t        gc_heap::min_loh_segment_size = 0;
 size_t        gc_heap::segment_info_size = 0;
 
@@ -3110,6 +3173,8 @@ void gc_heap::fire_pevents()
         gc_history_per_heap* current_gc_data_per_heap = hp->get_gc_data_per_heap();
         fire_per_heap_hist_event (current_gc_data_per_heap, hp->heap_number);
     }
+
+    fire_numa_node_alloc_events();
 #else
     gc_history_per_heap* current_gc_data_per_heap = get_gc_data_per_heap();
     fire_per_heap_hist_event (current_gc_data_per_heap, heap_number);
@@ -4465,10 +4530,10 @@ void* next_initial_memory (size_t size)
     return res;
 }
 
-heap_segment* get_initial_segment (size_t size, int h_number)
+heap_segment* get_initial_segment (size_t size, gc_oh_num oh, int h_number)
 {
     void* mem = next_initial_memory (size);
-    heap_segment* res = gc_heap::make_heap_segment ((uint8_t*)mem, size , h_number);
+    heap_segment* res = gc_heap::make_heap_segment ((uint8_t*)mem, size, oh, h_number);
 
     return res;
 }
@@ -4715,7 +4780,7 @@ gc_heap::soh_get_segment_to_expand()
         }
     }
 
-    heap_segment* result = get_segment (size, FALSE);
+    heap_segment* result = get_segment (get_soh_expansion_size(), FALSE);
 
     if(result)
     {
@@ -4754,6 +4819,30 @@ gc_heap::soh_get_segment_to_expand()
 #pragma warning(default:4706)
 #endif // _MSC_VER
 
+// Returns the size of the segment we should acquire when the ephemeral generations
+// need to move to a new segment. By default this is always soh_segment_size; with
+// GCRegionSize we only reserve what the surviving ephemeral generations plus the
+// next gen0 budget need, rounded up to the region size. This keeps heaps that don't
+// need much gen0 space from each holding on to a full sized segment, and a smaller
+// segment that becomes empty after a spike is much cheaper to give back.
+// compute_new_ephemeral_size must have been called before this.
+size_t gc_heap::get_soh_expansion_size()
+{
+    if (!soh_region_size)
+        return soh_segment_size;
+
+    dynamic_data* dd0 = dynamic_data_of (0);
+    size_t needed = segment_info_size + total_ephemeral_size + 
+                    max (approximate_new_allocation(), dd_desired_allocation (dd0));
+    size_t size = (needed + soh_region_size - 1) & ~(soh_region_size - 1);
+    size = min (size, soh_segment_size);
+
+    dprintf (GTC_LOG, ("h%d: eph needs %Id, new seg will be %Id (region %Id, seg %Id)",
+        heap_number, needed, size, soh_region_size, soh_segment_size));
+
+    return size;
+}
+
 //returns 0 in case of allocation failure
 heap_segment*
 gc_heap::get_segment (size_t size, BOOL loh_p)
@@ -4836,7 +4925,7 @@ gc_heap::get_segment (size_t size, BOOL loh_p)
             return 0;
         }
 
-        result = gc_heap::make_heap_segment ((uint8_t*)mem, size, heap_number);
+        result = gc_heap::make_heap_segment ((uint8_t*)mem, size, (loh_p ? oh_loh : oh_soh), heap_number);
 
         if (result)
         {
@@ -4963,12 +5052,32 @@ gc_heap::get_large_segment (size_t size, BOOL* did_full_compact_gc)
         *did_full_compact_gc = TRUE;
     }
 
+#ifdef BACKGROUND_GC
+    // Concurrent LOH sweep walks the segment list with only the msl held so we need it
+    // to thread the new segment. A BGC can't start while we hold the gc_lock so 
+    // if there isn't one running now we won't race with its sweep.
+    bool sync_with_loh_sweep_p = recursive_gc_sync::background_running_p();
+    if (sync_with_loh_sweep_p)
+    {
+        enter_spin_lock (&more_space_lock_loh);
+        add_saved_spinlock_info (true, me_acquire, mt_get_large_seg);
+    }
+#endif //BACKGROUND_GC
+
     heap_segment* res = get_segment_for_loh (size
 #ifdef MULTIPLE_HEAPS
                                             , this
 #endif //MULTIPLE_HEAPS
                                             );
 
+#ifdef BACKGROUND_GC
+    if (sync_with_loh_sweep_p)
+    {
+        add_saved_spinlock_info (true, me_release, mt_get_large_seg);
+        leave_spin_lock (&more_space_lock_loh);
+    }
+#endif //BACKGROUND_GC
+
     dprintf (SPINLOCK_LOG, ("[%d]Seg: A Lgc", heap_number));
     leave_spin_lock (&gc_heap::gc_lock);
     enter_spin_lock (&more_space_lock_loh);
@@ -5067,6 +5176,7 @@ class heap_select
     static uint16_t heap_no_to_proc_no[MAX_SUPPORTED_CPUS];
     static uint16_t heap_no_to_numa_node[MAX_SUPPORTED_CPUS];
     static uint16_t numa_node_to_heap_map[MAX_SUPPORTED_CPUS+4];
+    static bool numa_aware_p;
 
     static int access_time(uint8_t *sniff_buffer, int heap_number, unsigned sniff_index, unsigned n_sniff_buffers)
     {
@@ -5099,14 +5209,26 @@ public:
             memset(sniff_buffer, 0, sniff_buf_size*sizeof(uint8_t));
         }
 
+        // An EE that reports its NUMA topology can also keep the GC from being NUMA aware,
+        // e.g. when it was configured differently from the GC's own view of the machine.
+        uint16_t highest_node = 0;
+        numa_aware_p = GCToOSInterface::CanEnableGCNumaAware() &&
+                       ((GCToEEInterface::GetCapabilityVersion (GCToEECapability_NumaTopology) == 0) ||
+                        GCToEEInterface::GetNumaTopology (&highest_node));
+
         //can not enable gc numa aware, force all heaps to be in
         //one numa node by filling the array with all 0s
-        if (!GCToOSInterface::CanEnableGCNumaAware())
+        if (!numa_aware_p)
             memset(heap_no_to_numa_node, 0, sizeof (heap_no_to_numa_node)); 
 
         return TRUE;
     }
 
+    static bool is_numa_aware()
+    {
+        return numa_aware_p;
+    }
+
     static void init_cpu_mapping(gc_heap * /*heap*/, int heap_number)
     {
         if (GCToOSInterface::CanGetCurrentProcessorNumber())
@@ -5236,6 +5358,7 @@ uint16_t heap_select::proc_no_to_heap_no[MAX_SUPPORTED_CPUS];
 uint16_t heap_select::heap_no_to_proc_no[MAX_SUPPORTED_CPUS];
 uint16_t heap_select::heap_no_to_numa_node[MAX_SUPPORTED_CPUS];
 uint16_t heap_select::numa_node_to_heap_map[MAX_SUPPORTED_CPUS+4];
+bool heap_select::numa_aware_p;
 
 BOOL gc_heap::create_thread_support (unsigned number_of_heaps)
 {
@@ -5285,7 +5408,7 @@ void set_thread_affinity_for_heap(int heap_number)
     if (GCToOSInterface::GetProcessorForHeap(heap_number, &proc_no, &node_no))
     {
         heap_select::set_proc_no_for_heap(heap_number, proc_no);
-        if (node_no != NUMA_NODE_UNDEFINED)
+        if ((node_no != NUMA_NODE_UNDEFINED) && heap_select::is_numa_aware())
         {
             heap_select::set_numa_node_for_heap(heap_number, node_no);
         }
@@ -5319,7 +5442,13 @@ void gc_heap::gc_thread_function ()
 
         if (heap_number == 0)
         {
-            gc_heap::ee_suspend_event.Wait(INFINITE, FALSE);
+            uint32_t wait_result = gc_heap::ee_suspend_event.Wait(
+                (gradual_decommit_in_progress_p ? DECOMMIT_TIME_STEP_MILLISECONDS : INFINITE), FALSE);
+            if (wait_result == WAIT_TIMEOUT)
+            {
+                gradual_decommit_in_progress_p = decommit_step();
+                continue;
+            }
 
             BEGIN_TIMING(suspend_ee_during_log);
             GCToEEInterface::SuspendEE(SUSPEND_FOR_GC);
@@ -5430,7 +5559,7 @@ bool gc_heap::virtual_alloc_commit_for_heap (void* addr, size_t size, int h_numb
     if (!CLRMemoryHosted())
 #endif
     {
-        if (GCToOSInterface::CanEnableGCNumaAware())
+        if (heap_select::is_numa_aware())
         {
             uint16_t numa_node = heap_select::find_numa_node_from_heap_no(h_number);
             if (GCToOSInterface::VirtualCommit(addr, size, numa_node))
@@ -5445,7 +5574,7 @@ bool gc_heap::virtual_alloc_commit_for_heap (void* addr, size_t size, int h_numb
     return GCToOSInterface::VirtualCommit(addr, size);
 }
 
-bool gc_heap::virtual_commit (void* address, size_t size, int h_number, bool* hard_limit_exceeded_p)
+bool gc_heap::virtual_commit (void* address, size_t size, gc_oh_num oh, int h_number, bool* hard_limit_exceeded_p)
 {
 #ifndef BIT64
     assert (heap_hard_limit == 0);
@@ -5457,7 +5586,17 @@ bool gc_heap::virtual_commit (void* address, size_t size, int h_number, bool* ha
 
         check_commit_cs.Enter();
 
-        if ((current_total_committed + size) > heap_hard_limit)
+        if ((oh != oh_none) && heap_hard_limit_oh[oh] &&
+            ((committed_by_oh[oh] + size) > heap_hard_limit_oh[oh]))
+        {
+            dprintf (1, ("%Id + %Id = %Id > limit for oh%d %Id",
+                committed_by_oh[oh], size,
+                (committed_by_oh[oh] + size),
+                oh, heap_hard_limit_oh[oh]));
+
+            exceeded_p = true;
+        }
+        else if ((current_total_committed + size) > heap_hard_limit)
         {
             dprintf (1, ("%Id + %Id = %Id > limit",
                 current_total_committed, size,
@@ -5471,6 +5610,8 @@ bool gc_heap::virtual_commit (void* address, size_t size, int h_number, bool* ha
             current_total_committed += size;
             if (h_number < 0)
                 current_total_committed_bookkeeping += size;
+            if (oh != oh_none)
+                committed_by_oh[oh] += size;
         }
 
         check_commit_cs.Leave();
@@ -5487,9 +5628,11 @@ bool gc_heap::virtual_commit (void* address, size_t size, int h_number, bool* ha
 
     // If it's a valid heap number it means it's commiting for memory on the GC heap.
     // In addition if large pages is enabled, we set commit_succeeded_p to true because memory is already committed.
+    // Same for book keeping that's in a card table on large pages.
     bool commit_succeeded_p = ((h_number >= 0) ? (use_large_pages_p ? true :
                               virtual_alloc_commit_for_heap (address, size, h_number)) :
-                              GCToOSInterface::VirtualCommit(address, size));
+                              (on_bookkeeping_large_pages_p ((uint8_t*)address, size) ? true : 
+                                GCToOSInterface::VirtualCommit(address, size)));
 
     if (!commit_succeeded_p && heap_hard_limit)
     {
@@ -5499,6 +5642,8 @@ bool gc_heap::virtual_commit (void* address, size_t size, int h_number, bool* ha
         current_total_committed -= size;
         if (h_number < 0)
             current_total_committed_bookkeeping -= size;
+        if (oh != oh_none)
+            committed_by_oh[oh] -= size;
 
         check_commit_cs.Leave();
     }
@@ -5506,7 +5651,7 @@ bool gc_heap::virtual_commit (void* address, size_t size, int h_number, bool* ha
     return commit_succeeded_p;
 }
 
-bool gc_heap::virtual_decommit (void* address, size_t size, int h_number)
+bool gc_heap::virtual_decommit (void* address, size_t size, gc_oh_num oh, int h_number)
 {
 #ifndef BIT64
     assert (heap_hard_limit == 0);
@@ -5520,6 +5665,8 @@ bool gc_heap::virtual_decommit (void* address, size_t size, int h_number)
         current_total_committed -= size;
         if (h_number < 0)
             current_total_committed_bookkeeping -= size;
+        if (oh != oh_none)
+            committed_by_oh[oh] -= size;
         check_commit_cs.Leave();
     }
 
@@ -6713,6 +6860,14 @@ uint8_t* align_lower_card (uint8_t* add)
     return (uint8_t*)((size_t)add & ~(card_size-1));
 }
 
+#ifdef CARD_MARKING_STEALING
+inline
+uint8_t* align_lower_card_word (uint8_t* add)
+{
+    return (uint8_t*)((size_t)add & ~(card_size*card_word_width - 1));
+}
+#endif //CARD_MARKING_STEALING
+
 inline
 void gc_heap::clear_card (size_t card)
 {
@@ -6780,6 +6935,8 @@ public:
 
     size_t      size;
     uint32_t*   next_card_table;
+    // The whole table was committed up front on large pages.
+    bool        large_pages_p;
 };
 
 //These are accessors on untranslated cardtable
@@ -7036,6 +7193,12 @@ uint32_t*& card_table_next (uint32_t* c_table)
     return ((card_table_info*)((uint8_t*)c_table - sizeof (card_table_info)))->next_card_table;
 }
 
+inline
+bool& card_table_large_pages_p (uint32_t* c_table)
+{
+    return ((card_table_info*)((uint8_t*)c_table - sizeof (card_table_info)))->large_pages_p;
+}
+
 inline
 size_t& card_table_size (uint32_t* c_table)
 {
@@ -7110,6 +7273,30 @@ void destroy_card_table (uint32_t* c_table)
     dprintf (2, ("Table Virtual Free : %Ix", (size_t)&card_table_refcount(c_table)));
 }
 
+// Returns true if [address, address + size) is in a card table that was committed
+// up front on large pages. Old tables stay linked from the current one until they
+// are destroyed, and heaps can still be using their mark arrays, so we look at all of them.
+bool gc_heap::on_bookkeeping_large_pages_p (uint8_t* address, size_t size)
+{
+    if (!bookkeeping_large_pages_used_p)
+        return false;
+
+    uint32_t* c_table = bookkeeping_new_card_table;
+    if (!c_table && g_gc_card_table)
+        c_table = &g_gc_card_table[card_word (gcard_of (g_gc_lowest_address))];
+
+    while (c_table)
+    {
+        uint8_t* mem = (uint8_t*)&card_table_refcount (c_table);
+        if ((address >= mem) && ((address + size) <= (mem + card_table_size (c_table))))
+            return card_table_large_pages_p (c_table);
+
+        c_table = card_table_next (c_table);
+    }
+
+    return false;
+}
+
 uint32_t* gc_heap::make_card_table (uint8_t* start, uint8_t* end)
 {
     assert (g_gc_lowest_address == start);
@@ -7165,7 +7352,27 @@ uint32_t* gc_heap::make_card_table (uint8_t* start, uint8_t* end)
     // it is impossible for alloc_size to overflow due bounds on each of 
     // its components.
     size_t alloc_size = sizeof (uint8_t)*(sizeof(card_table_info) + cs + bs + cb + wws + st + ms);
-    uint8_t* mem = (uint8_t*)GCToOSInterface::VirtualReserve (alloc_size, 0, virtual_reserve_flags);
+    uint8_t* mem = 0;
+
+    if (bookkeeping_large_pages_p)
+    {
+        // Large pages can't be write watched.
+        if (virtual_reserve_flags == VirtualReserveFlags::None)
+        {
+            mem = (uint8_t*)GCToOSInterface::VirtualReserveAndCommitLargePages (alloc_size);
+        }
+
+        dprintf (1, ("Init - large pages for %Id bytes of card table %s",
+                     alloc_size, (mem ? "succeeded" : "failed, using normal pages")));
+        FIRE_EVENT(GCBookkeepingLargePages, (uint32_t)(mem != 0), (uint64_t)alloc_size);
+
+        bookkeeping_large_pages_p = (mem != 0);
+    }
+
+    bool large_pages_p = (mem != 0);
+
+    if (!mem)
+        mem = (uint8_t*)GCToOSInterface::VirtualReserve (alloc_size, 0, virtual_reserve_flags);
 
     if (!mem)
         return 0;
@@ -7173,24 +7380,39 @@ uint32_t* gc_heap::make_card_table (uint8_t* start, uint8_t* end)
     dprintf (2, ("Init - Card table alloc for %Id bytes: [%Ix, %Ix[",
                  alloc_size, (size_t)mem, (size_t)(mem+alloc_size)));
 
-    // mark array will be committed separately (per segment).
-    size_t commit_size = alloc_size - ms;
+    uint32_t* ct = (uint32_t*)(mem+sizeof (card_table_info));
 
-    if (!virtual_commit (mem, commit_size))
+    if (large_pages_p)
+    {
+        // This is already committed, so make it known to virtual_commit which then
+        // only needs to account for it.
+        card_table_size (ct) = alloc_size;
+        card_table_next (ct) = 0;
+        card_table_large_pages_p (ct) = true;
+        bookkeeping_large_pages_used_p = true;
+        bookkeeping_new_card_table = ct;
+    }
+
+    // mark array will be committed separately (per segment), unless it's on
+    // large pages in which case it's already committed.
+    size_t commit_size = large_pages_p ? alloc_size : (alloc_size - ms);
+
+    if (!virtual_commit (mem, commit_size, oh_none))
     {
         dprintf (1, ("Card table commit failed"));
+        bookkeeping_new_card_table = 0;
         GCToOSInterface::VirtualRelease (mem, alloc_size);
         return 0;
     }
     
     // initialize the ref count
-    uint32_t* ct = (uint32_t*)(mem+sizeof (card_table_info));
     card_table_refcount (ct) = 0;
     card_table_lowest_address (ct) = start;
     card_table_highest_address (ct) = end;
     card_table_brick_table (ct) = (short*)((uint8_t*)ct + cs);
     card_table_size (ct) = alloc_size;
     card_table_next (ct) = 0;
+    card_table_large_pages_p (ct) = large_pages_p;
 
 #ifdef CARD_BUNDLE
     card_table_card_bundle_table (ct) = (uint32_t*)((uint8_t*)card_table_brick_table (ct) + bs);
@@ -7221,6 +7443,9 @@ uint32_t* gc_heap::make_card_table (uint8_t* start, uint8_t* end)
         card_table_mark_array (ct) = NULL;
 #endif //MARK_ARRAY
 
+    // The caller makes this the current table right away.
+    bookkeeping_new_card_table = 0;
+
     return translate_card_table(ct);
 }
 
@@ -7373,7 +7598,23 @@ int gc_heap::grow_brick_card_tables (uint8_t* start,
         dprintf (GC_TABLE_LOG, ("card table: %Id; brick table: %Id; card bundle: %Id; sw ww table: %Id; seg table: %Id; mark array: %Id",
                                   cs, bs, cb, wws, st, ms));
 
-        uint8_t* mem = (uint8_t*)GCToOSInterface::VirtualReserve (alloc_size, 0, virtual_reserve_flags);
+        // Which tables are on large pages is kept per table, so if this one can't get
+        // them it (and the later ones) just use normal pages.
+        uint8_t* mem = 0;
+        if (bookkeeping_large_pages_p)
+        {
+            mem = (uint8_t*)GCToOSInterface::VirtualReserveAndCommitLargePages (alloc_size);
+            if (!mem)
+            {
+                dprintf (GC_TABLE_LOG, ("large pages for %Id bytes of card table failed, using normal pages", alloc_size));
+                bookkeeping_large_pages_p = false;
+            }
+        }
+
+        bool large_pages_p = (mem != 0);
+
+        if (!mem)
+            mem = (uint8_t*)GCToOSInterface::VirtualReserve (alloc_size, 0, virtual_reserve_flags);
 
         if (!mem)
         {
@@ -7381,14 +7622,28 @@ int gc_heap::grow_brick_card_tables (uint8_t* start,
             goto fail;
         }
 
-        dprintf (GC_TABLE_LOG, ("Table alloc for %Id bytes: [%Ix, %Ix[",
-                                 alloc_size, (size_t)mem, (size_t)((uint8_t*)mem+alloc_size)));
+        dprintf (GC_TABLE_LOG, ("Table alloc for %Id bytes: [%Ix, %Ix[%s",
+                                 alloc_size, (size_t)mem, (size_t)((uint8_t*)mem+alloc_size),
+                                 (large_pages_p ? " on large pages" : "")));
+
+        ct = (uint32_t*)(mem + sizeof (card_table_info));
+
+        if (large_pages_p)
+        {
+            // This is already committed, so make it known to virtual_commit which then
+            // only needs to account for it.
+            card_table_size (ct) = alloc_size;
+            card_table_next (ct) = &g_gc_card_table[card_word (gcard_of (la))];
+            card_table_large_pages_p (ct) = true;
+            bookkeeping_large_pages_used_p = true;
+            bookkeeping_new_card_table = ct;
+        }
 
         {   
             // mark array will be committed separately (per segment).
-            size_t commit_size = alloc_size - ms;
+            size_t commit_size = large_pages_p ? alloc_size : (alloc_size - ms);
 
-            if (!virtual_commit (mem, commit_size))
+            if (!virtual_commit (mem, commit_size, oh_none))
             {
                 dprintf (GC_TABLE_LOG, ("Table commit failed"));
                 set_fgm_result (fgm_commit_table, commit_size, loh_p);
@@ -7396,11 +7651,14 @@ int gc_heap::grow_brick_card_tables (uint8_t* start,
             }
         }
 
-        ct = (uint32_t*)(mem + sizeof (card_table_info));
         card_table_refcount (ct) = 0;
         card_table_lowest_address (ct) = saved_g_lowest_address;
         card_table_highest_address (ct) = saved_g_highest_address;
+        card_table_size (ct) = alloc_size;
         card_table_next (ct) = &g_gc_card_table[card_word (gcard_of (la))];
+        card_table_large_pages_p (ct) = large_pages_p;
+        // The mark array commits below are into this table.
+        bookkeeping_new_card_table = ct;
 
         //clear the card table
 /*
@@ -7556,11 +7814,16 @@ int gc_heap::grow_brick_card_tables (uint8_t* start,
             stomp_write_barrier_resize(GCToEEInterface::IsGCThread(), la != saved_g_lowest_address);
         }
 
+        // It's reachable as the current table now.
+        bookkeeping_new_card_table = 0;
+
         return 0;
         
 fail:
         //cleanup mess and return -1;
 
+        bookkeeping_new_card_table = 0;
+
         if (mem)
         {
             assert(g_gc_card_table == saved_g_card_table);
@@ -7950,6 +8213,49 @@ uint8_t** make_mark_list (size_t size)
     return mark_list;
 }
 
+// Called with all GC threads synchronized before marking starts. If the last ephemeral GC overflowed the
+// mark list, double it (up to max_mark_list_size). Failing to get the bigger list is not an error, we
+// just keep using the current one.
+void gc_heap::grow_mark_list ()
+{
+    if (!mark_list_overflow)
+        return;
+
+    mark_list_overflow = FALSE;
+
+    size_t new_mark_list_size = min (mark_list_size * 2, max_mark_list_size);
+    if (new_mark_list_size <= mark_list_size)
+        return;
+
+#ifdef MULTIPLE_HEAPS
+    size_t new_total_size = new_mark_list_size * n_heaps;
+#else
+    size_t new_total_size = new_mark_list_size;
+#endif //MULTIPLE_HEAPS
+
+    uint8_t** new_mark_list = make_mark_list (new_total_size);
+    if (!new_mark_list)
+        return;
+
+#ifdef PARALLEL_MARK_LIST_SORT
+    uint8_t** new_mark_list_copy = make_mark_list (new_total_size);
+    if (!new_mark_list_copy)
+    {
+        delete[] new_mark_list;
+        return;
+    }
+    delete[] g_mark_list_copy;
+    g_mark_list_copy = new_mark_list_copy;
+#endif //PARALLEL_MARK_LIST_SORT
+
+    delete[] g_mark_list;
+    g_mark_list = new_mark_list;
+
+    dprintf (2, ("mark list overflowed, growing it from %Id to %Id entries per heap",
+        mark_list_size, new_mark_list_size));
+    mark_list_size = new_mark_list_size;
+}
+
 #define swap(a,b){uint8_t* t; t = a; a = b; b = t;}
 
 void verify_qsort_array (uint8_t* *low, uint8_t* *high)
@@ -9201,12 +9507,12 @@ int gc_heap::object_gennum_plan (uint8_t* o)
 #pragma optimize("", on)        // Go back to command line default optimizations
 #endif //_MSC_VER && _TARGET_X86_
 
-heap_segment* gc_heap::make_heap_segment (uint8_t* new_pages, size_t size, int h_number)
+heap_segment* gc_heap::make_heap_segment (uint8_t* new_pages, size_t size, gc_oh_num oh, int h_number)
 {
     size_t initial_commit = SEGMENT_INITIAL_COMMIT;
 
     //Commit the first page
-    if (!virtual_commit (new_pages, initial_commit, h_number))
+    if (!virtual_commit (new_pages, initial_commit, oh, h_number))
     {
         return 0;
     }
@@ -9317,19 +9623,31 @@ void gc_heap::decommit_heap_segment_pages (heap_segment* seg,
     if (size >= max ((extra_space + 2*OS_PAGE_SIZE), 100*OS_PAGE_SIZE))
     {
         page_start += max(extra_space, 32*OS_PAGE_SIZE);
-        size -= max (extra_space, 32*OS_PAGE_SIZE);
+        decommit_heap_segment_pages_worker (seg, page_start);
+    }
+}
 
-        virtual_decommit (page_start, size, heap_number);
-        dprintf (3, ("Decommitting heap segment [%Ix, %Ix[(%d)", 
-            (size_t)page_start, 
-            (size_t)(page_start + size),
-            size));
-        heap_segment_committed (seg) = page_start;
-        if (heap_segment_used (seg) > heap_segment_committed (seg))
-        {
-            heap_segment_used (seg) = heap_segment_committed (seg);
-        }
+// Decommits [new_committed, committed) of seg and returns how much that was.
+size_t gc_heap::decommit_heap_segment_pages_worker (heap_segment* seg,
+                                                    uint8_t* new_committed)
+{
+    assert (!use_large_pages_p);
+    uint8_t* page_start = align_on_page (new_committed);
+    if (page_start >= heap_segment_committed (seg))
+        return 0;
+
+    size_t size = heap_segment_committed (seg) - page_start;
+    virtual_decommit (page_start, size, heap_segment_oh (seg), heap_number);
+    dprintf (3, ("Decommitting heap segment [%Ix, %Ix[(%d)", 
+        (size_t)page_start, 
+        (size_t)(page_start + size),
+        size));
+    heap_segment_committed (seg) = page_start;
+    if (heap_segment_used (seg) > heap_segment_committed (seg))
+    {
+        heap_segment_used (seg) = heap_segment_committed (seg);
     }
+    return size;
 }
 
 //decommit all pages except one or 2
@@ -9344,7 +9662,7 @@ void gc_heap::decommit_heap_segment (heap_segment* seg)
 #endif //BACKGROUND_GC
 
     size_t size = heap_segment_committed (seg) - page_start;
-    virtual_decommit (page_start, size, heap_number);
+    virtual_decommit (page_start, size, heap_segment_oh (seg), heap_number);
 
     //re-init the segment object
     heap_segment_committed (seg) = page_start;
@@ -9855,10 +10173,10 @@ FILE* CreateLogFile(const GCConfigStringHolder& temp_logfile_name, bool is_confi
 }
 #endif //TRACE_GC || GC_CONFIG_DRIVEN
 
-size_t gc_heap::get_segment_size_hard_limit (uint32_t* num_heaps, bool should_adjust_num_heaps)
+size_t gc_heap::get_segment_size_hard_limit (size_t limit, uint32_t* num_heaps, bool should_adjust_num_heaps)
 {
-    assert (heap_hard_limit);
-    size_t aligned_hard_limit = ((heap_hard_limit + min_segment_size_hard_limit - 1) & ~(min_segment_size_hard_limit - 1));
+    assert (limit);
+    size_t aligned_hard_limit = ((limit + min_segment_size_hard_limit - 1) & ~(min_segment_size_hard_limit - 1));
     if (should_adjust_num_heaps)
     {
         uint32_t max_num_heaps = (uint32_t)(aligned_hard_limit / min_segment_size_hard_limit);
@@ -9890,6 +10208,16 @@ size_t gc_heap::get_segment_size_hard_limit (uint32_t* num_heaps, bool should_ad
     return aligned_seg_size;
 }
 
+size_t gc_heap::get_hard_limit_for (gc_oh_num oh)
+{
+    return (heap_hard_limit_oh[oh] ? heap_hard_limit_oh[oh] : heap_hard_limit);
+}
+
+size_t gc_heap::get_committed_for (gc_oh_num oh)
+{
+    return (heap_hard_limit_oh[oh] ? committed_by_oh[oh] : current_total_committed);
+}
+
 HRESULT gc_heap::initialize_gc (size_t segment_size,
                                 size_t heap_size
 #ifdef MULTIPLE_HEAPS
@@ -10096,8 +10424,33 @@ HRESULT gc_heap::initialize_gc (size_t segment_size,
     if (!heap_select::init (number_of_heaps))
         return E_OUTOFMEMORY;
 
+    n_active_heaps = number_of_heaps;
+    dynamic_heap_count_p = (number_of_heaps > 1) && GCConfig::GetDynamicHeapCount();
+
 #endif //MULTIPLE_HEAPS
 
+    int conserve_mem_setting = (int)GCConfig::GetGCConserveMem();
+    if ((conserve_mem_setting > 0) && (conserve_mem_setting < 100))
+    {
+        conserve_mem_frag_target = conserve_mem_setting;
+    }
+
+    pause_target_ms = (size_t)GCConfig::GetGCPauseTarget();
+    memory_pressure_stall_th = (uint32_t)min (max ((int)GCConfig::GetGCMemoryPressureStall(), 0), 100);
+
+#ifdef MULTIPLE_HEAPS
+    gradual_decommit_p = GCConfig::GetGCGradualDecommit();
+#endif //MULTIPLE_HEAPS
+    pause_target_miss_count = 0;
+    pause_target_budget_pct = 100;
+
+    // Past 16x the refill savings don't matter much and we'd hand out too much of gen0.
+    alloc_quantum_max_shift = min (max ((int)GCConfig::GetGCAllocQuantumMaxShift(), 0), 4);
+
+#ifdef BACKGROUND_GC
+    concurrent_loh_sweep_p = GCConfig::GetGCConcurrentLOHSweep();
+#endif //BACKGROUND_GC
+
 #ifdef MULTIPLE_HEAPS
     yp_spin_count_unit = 32 * number_of_heaps;
 #else
@@ -10157,6 +10510,11 @@ gc_heap::init_semi_shared()
     {
         goto cleanup;
     }
+
+    // Ephemeral GCs that overflow the mark list fall back to walking the whole condemned range, so
+    // let the list grow, within bounds, when that happens.
+    max_mark_list_size = max (mark_list_size, (size_t)(1024*1024));
+    mark_list_overflow = FALSE;
 #endif //MARK_LIST
 
 #if defined(SEG_MAPPING_TABLE) && !defined(GROWABLE_SEG_MAPPING_TABLE)
@@ -10262,6 +10620,10 @@ gc_heap* gc_heap::make_gc_heap (
 
     res->vm_heap = vm_hp;
     res->alloc_context_count = 0;
+    res->alloc_context_local_switches = 0;
+    res->alloc_context_remote_switches = 0;
+    res->last_numa_event_alloc_bytes = 0;
+    res->ephemeral_decommit_target = 0;
 
 #ifdef MARK_LIST
 #ifdef PARALLEL_MARK_LIST_SORT
@@ -10510,6 +10872,10 @@ gc_heap::init_gc_heap (int  h_number)
 
     gen0_allocated_after_gc_p = false;
 
+#ifdef BACKGROUND_GC
+    bgc_share_count = 0;
+#endif //BACKGROUND_GC
+
 #ifdef RECORD_LOH_STATE
     loh_state_index = 0;
 #endif //RECORD_LOH_STATE
@@ -10541,7 +10907,7 @@ gc_heap::init_gc_heap (int  h_number)
     }
 #endif //!SEG_MAPPING_TABLE
 
-    heap_segment* seg = get_initial_segment (soh_segment_size, h_number);
+    heap_segment* seg = get_initial_segment (soh_segment_size, oh_soh, h_number);
     if (!seg)
         return 0;
 
@@ -10605,7 +10971,7 @@ gc_heap::init_gc_heap (int  h_number)
     }
 #endif //!SEG_MAPPING_TABLE
     //Create the large segment generation
-    heap_segment* lseg = get_initial_segment(min_loh_segment_size, h_number);
+    heap_segment* lseg = get_initial_segment(min_loh_segment_size, oh_loh, h_number);
     if (!lseg)
         return 0;
     lseg->flags |= heap_segment_flags_loh;
@@ -10803,6 +11169,7 @@ gc_heap::init_gc_heap (int  h_number)
     current_bgc_state = bgc_not_in_process;
     background_soh_alloc_count = 0;
     background_loh_alloc_count = 0;
+    loh_sweep_concurrent_p = false;
     bgc_overflow_count = 0;
     end_loh_size = dd_min_size (dynamic_data_of (max_generation + 1));
 #endif //BACKGROUND_GC
@@ -11001,7 +11368,7 @@ BOOL gc_heap::grow_heap_segment (heap_segment* seg, uint8_t* high_address, bool*
                 "Growing heap_segment: %Ix high address: %Ix\n",
                 (size_t)seg, (size_t)high_address);
 
-    bool ret = virtual_commit (heap_segment_committed (seg), c_size, heap_number, hard_limit_exceeded_p);
+    bool ret = virtual_commit (heap_segment_committed (seg), c_size, heap_segment_oh (seg), heap_number, hard_limit_exceeded_p);
     if (ret)
     {
 #ifdef MARK_ARRAY
@@ -11242,11 +11609,22 @@ void gc_heap::check_batch_mark_array_bits (uint8_t* start, uint8_t* end)
 allocator::allocator (unsigned int num_b, size_t fbs, alloc_list* b)
 {
     assert (num_b < MAX_BUCKET_COUNT);
+    assert ((fbs & (fbs - 1)) == 0);
     num_buckets = num_b;
     frst_bucket_size = fbs;
+    frst_bucket_bits = (unsigned int)index_of_highest_set_bit (fbs);
     buckets = b;
 }
 
+unsigned int allocator::first_suitable_bucket (size_t size)
+{
+    if ((num_buckets == 1) || (size < frst_bucket_size))
+        return 0;
+
+    unsigned int bn = (unsigned int)index_of_highest_set_bit (size >> frst_bucket_bits) + 1;
+    return min (bn, (unsigned int)(num_buckets - 1));
+}
+
 alloc_list& allocator::alloc_list_of (unsigned int bn)
 {
     assert (bn < num_buckets);
@@ -11327,17 +11705,7 @@ void allocator::thread_free_item (uint8_t* item, uint8_t*& head, uint8_t*& tail)
 
 void allocator::thread_item (uint8_t* item, size_t size)
 {
-    size_t sz = frst_bucket_size;
-    unsigned int a_l_number = 0; 
-
-    for (; a_l_number < (num_buckets-1); a_l_number++)
-    {
-        if (size < sz)
-        {
-            break;
-        }
-        sz = sz * 2;
-    }
+    unsigned int a_l_number = first_suitable_bucket (size);
     alloc_list* al = &alloc_list_of (a_l_number);
     thread_free_item (item, 
                       al->alloc_list_head(),
@@ -11347,16 +11715,7 @@ void allocator::thread_item (uint8_t* item, size_t size)
 void allocator::thread_item_front (uint8_t* item, size_t size)
 {
     //find right free list
-    size_t sz = frst_bucket_size;
-    unsigned int a_l_number = 0; 
-    for (; a_l_number < (num_buckets-1); a_l_number++)
-    {
-        if (size < sz)
-        {
-            break;
-        }
-        sz = sz * 2;
-    }
+    unsigned int a_l_number = first_suitable_bucket (size);
     alloc_list* al = &alloc_list_of (a_l_number);
     free_list_slot (item) = al->alloc_list_head();
     free_list_undo (item) = UNDO_EMPTY;
@@ -11664,8 +12023,30 @@ size_t gc_heap::new_allocation_limit (size_t size, size_t physical_limit, int ge
     return limit;
 }
 
-size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_limit, int gen_number,
-                                 int align_const)
+size_t gc_heap::get_alloc_quantum (alloc_context* acontext)
+{
+    size_t quantum = allocation_quantum;
+    int refills = acontext->alloc_count;
+    int shift = 0;
+
+    // Threads that keep coming back for more get bigger chunks so they take the msl less often;
+    // the per GC quantum still applies to everyone else.
+    while ((shift < alloc_quantum_max_shift) && (refills >= (alloc_quantum_hot_refills << shift)))
+    {
+        shift++;
+    }
+
+    if (shift)
+    {
+        quantum <<= shift;
+        dprintf (3, ("ac %Ix refilled %d times, quantum %Id", (size_t)acontext, refills, quantum));
+    }
+
+    return quantum;
+}
+
+size_t gc_heap::limit_from_size (size_t size, uint32_t flags, alloc_context* acontext, 
+                                 size_t physical_limit, int gen_number, int align_const)
 {
     size_t padded_size = size + Align (min_obj_size, align_const);
     // for LOH this is not true...we could select a physical_limit that's exactly the same
@@ -11674,7 +12055,7 @@ size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_li
 
     // For SOH if the size asked for is very small, we want to allocate more than just what's asked for if possible. 
     // Unless we were told not to clean, then we will not force it.
-    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? allocation_quantum : 0);
+    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? get_alloc_quantum (acontext) : 0);
 
     size_t desired_size_to_allocate  = max (padded_size, min_size_to_allocate);
     size_t new_physical_limit = min (physical_limit, desired_size_to_allocate);
@@ -12024,7 +12405,7 @@ BOOL gc_heap::a_fit_free_list_p (int gen_number,
                     // We ask for more Align (min_obj_size)
                     // to make sure that we can insert a free object
                     // in adjust_limit will set the limit lower
-                    size_t limit = limit_from_size (size, flags, free_list_size, gen_number, align_const);
+                    size_t limit = limit_from_size (size, flags, acontext, free_list_size, gen_number, align_const);
 
                     uint8_t*  remain = (free_list + limit);
                     size_t remain_size = (free_list_size - limit);
@@ -12195,7 +12576,7 @@ BOOL gc_heap::a_fit_free_list_large_p (size_t size,
                     loh_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
 
                     // Substract min obj size because limit_from_size adds it. Not needed for LOH
-                    size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, free_list_size, 
+                    size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, acontext, free_list_size, 
                                                     gen_number, align_const);
 
 #ifdef FEATURE_LOH_COMPACTION
@@ -12288,6 +12669,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
     {
         limit = limit_from_size (size, 
                                  flags,
+                                 acontext,
                                  (end - allocated), 
                                  gen_number, align_const);
         goto found_fit;
@@ -12299,6 +12681,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
     {
         limit = limit_from_size (size, 
                                  flags,
+                                 acontext,
                                  (end - allocated), 
                                  gen_number, align_const);
 
@@ -12400,6 +12783,7 @@ BOOL gc_heap::loh_a_fit_segment_end_p (int gen_number,
     *commit_failed_p = FALSE;
     heap_segment* seg = generation_allocation_segment (generation_of (gen_number));
     BOOL can_allocate_p = FALSE;
+    BOOL poh_p = ((flags & GC_ALLOC_PINNED_OBJECT_HEAP) != 0);
 
     while (seg)
     {
@@ -12410,6 +12794,13 @@ BOOL gc_heap::loh_a_fit_segment_end_p (int gen_number,
         }
         else
 #endif //BACKGROUND_GC
+        // Pinned objects are only bump allocated on pinned segments and other 
+        // large objects never are, so the pinned ones stay packed together.
+        if (heap_segment_poh_p (seg) != poh_p)
+        {
+            dprintf (3, ("h%d skipping seg %Ix (poh: %d)", heap_number, (size_t)seg, heap_segment_poh_p (seg)));
+        }
+        else
         {
             if (a_fit_segment_end_p (gen_number, seg, (size - Align (min_obj_size, align_const)), 
                                         acontext, flags, align_const, commit_failed_p))
@@ -12857,6 +13248,7 @@ size_t gc_heap::get_large_seg_size (size_t size)
 
 BOOL gc_heap::loh_get_new_seg (generation* gen,
                                size_t size,
+                               uint32_t flags,
                                int align_const,
                                BOOL* did_full_compact_gc,
                                oom_reason* oom_r)
@@ -12872,6 +13264,12 @@ BOOL gc_heap::loh_get_new_seg (generation* gen,
 
     if (new_seg)
     {
+        if (flags & GC_ALLOC_PINNED_OBJECT_HEAP)
+        {
+            dprintf (2, ("h%d new seg %Ix is for pinned objects", heap_number, (size_t)new_seg));
+            new_seg->flags |= heap_segment_flags_poh;
+        }
+
         loh_alloc_since_cg += seg_size;
     }
     else
@@ -12943,7 +13341,14 @@ BOOL gc_heap::loh_try_fit (int gen_number,
 {
     BOOL can_allocate = TRUE;
 
-    if (!a_fit_free_list_large_p (size, acontext, flags, align_const))
+    // The free list is shared by all LOH segments so pinned objects don't use it - 
+    // they could end up on a segment that LOH compaction moves objects on.
+    // It's also off limits while background sweep is rebuilding it concurrently.
+    if ((flags & GC_ALLOC_PINNED_OBJECT_HEAP) ||
+#ifdef BACKGROUND_GC
+        loh_sweep_concurrent_p ||
+#endif //BACKGROUND_GC
+        !a_fit_free_list_large_p (size, acontext, flags, align_const))
     {
         can_allocate = loh_a_fit_segment_end_p (gen_number, size, 
                                                 acontext, flags, align_const, 
@@ -13056,14 +13461,16 @@ bool gc_heap::should_retry_other_heap (size_t size)
 #ifdef MULTIPLE_HEAPS
     if (heap_hard_limit)
     {
-        size_t total_heap_committed_recorded = 
-            current_total_committed - current_total_committed_bookkeeping;
+        // This is only used for LOH allocations so with a LOH limit that's what we check against.
+        size_t limit = get_hard_limit_for (oh_loh);
+        size_t total_heap_committed_recorded = (heap_hard_limit_oh[oh_loh] ? 
+            committed_by_oh[oh_loh] : (current_total_committed - current_total_committed_bookkeeping));
         size_t min_size = dd_min_size (g_heaps[0]->dynamic_data_of (max_generation + 1));
         size_t slack_space = max (commit_min_th, min_size);
-        bool retry_p = ((total_heap_committed_recorded + size) < (heap_hard_limit - slack_space));
+        bool retry_p = ((total_heap_committed_recorded + size) < (limit - slack_space));
         dprintf (1, ("%Id - %Id - total committed %Id - size %Id = %Id, %s",
-            heap_hard_limit, slack_space, total_heap_committed_recorded, size,
-            (heap_hard_limit - slack_space - total_heap_committed_recorded - size),
+            limit, slack_space, total_heap_committed_recorded, size,
+            (limit - slack_space - total_heap_committed_recorded - size),
             (retry_p ? "retry" : "no retry")));
         return retry_p;
     }
@@ -13209,7 +13616,7 @@ allocation_state gc_heap::allocate_large (int gen_number,
 
                 current_full_compact_gc_count = get_full_compact_gc_count();
 
-                can_get_new_seg_p = loh_get_new_seg (gen, size, align_const, &did_full_compacting_gc, &oom_r);
+                can_get_new_seg_p = loh_get_new_seg (gen, size, flags, align_const, &did_full_compacting_gc, &oom_r);
                 loh_alloc_state = (can_get_new_seg_p ? 
                                         a_state_try_fit_new_seg : 
                                         (did_full_compacting_gc ? 
@@ -13224,7 +13631,7 @@ allocation_state gc_heap::allocate_large (int gen_number,
 
                 current_full_compact_gc_count = get_full_compact_gc_count();
 
-                can_get_new_seg_p = loh_get_new_seg (gen, size, align_const, &did_full_compacting_gc, &oom_r);
+                can_get_new_seg_p = loh_get_new_seg (gen, size, flags, align_const, &did_full_compacting_gc, &oom_r);
                 // Since we release the msl before we try to allocate a seg, other
                 // threads could have allocated a bunch of segments before us so
                 // we might need to retry.
@@ -13240,7 +13647,7 @@ allocation_state gc_heap::allocate_large (int gen_number,
              
                 current_full_compact_gc_count = get_full_compact_gc_count();
 
-                can_get_new_seg_p = loh_get_new_seg (gen, size, align_const, &did_full_compacting_gc, &oom_r); 
+                can_get_new_seg_p = loh_get_new_seg (gen, size, flags, align_const, &did_full_compacting_gc, &oom_r); 
                 loh_alloc_state = (can_get_new_seg_p ? 
                                         a_state_try_fit_new_seg : 
                                         (did_full_compacting_gc ? 
@@ -13498,7 +13905,7 @@ void gc_heap::balance_heaps (alloc_context* acontext)
     {
         if (acontext->alloc_count == 0)
         {
-            acontext->set_home_heap(GCHeap::GetHeap( heap_select::select_heap(acontext, 0) ));
+            acontext->set_home_heap(GCHeap::GetHeap( heap_select::select_heap(acontext, 0) % n_active_heaps ));
             gc_heap* hp = acontext->get_home_heap()->pGenGCHeap;
             dprintf (3, ("First allocation for context %Ix on heap %d\n", (size_t)acontext, (size_t)hp->heap_number));
             acontext->set_alloc_heap(acontext->get_home_heap());
@@ -13526,6 +13933,21 @@ void gc_heap::balance_heaps (alloc_context* acontext)
                 set_home_heap = TRUE;
         }
 
+        if (acontext->get_alloc_heap()->pGenGCHeap->heap_number >= n_active_heaps)
+        {
+            // The heap this context was allocating on is no longer taking allocations, 
+            // move it back to an active heap right away.
+            gc_heap* org_hp = acontext->get_alloc_heap()->pGenGCHeap;
+            int new_hn = heap_select::select_heap(acontext, hint) % n_active_heaps;
+            acontext->set_home_heap(GCHeap::GetHeap(new_hn));
+            acontext->set_alloc_heap(acontext->get_home_heap());
+            org_hp->alloc_context_count--;
+            acontext->get_alloc_heap()->pGenGCHeap->alloc_context_count++;
+            dprintf (3, ("Moving context %p from inactive heap %d to heap %d",
+                         acontext, org_hp->heap_number, new_hn));
+            set_home_heap = FALSE;
+        }
+
         if (set_home_heap)
         {
 /*
@@ -13550,16 +13972,25 @@ void gc_heap::balance_heaps (alloc_context* acontext)
                 ptrdiff_t max_size;
                 size_t delta = dd_min_size (dd)/4;
 
+                // Look at the heaps on the node the thread is running on first - that's
+                // the node of its home heap, which isn't necessarily the node of the heap 
+                // it's been allocating on.
+                acontext->set_home_heap(GCHeap::GetHeap( heap_select::select_heap(acontext, hint) % n_active_heaps ));
+                uint16_t home_node = heap_select::find_numa_node_from_heap_no (acontext->get_home_heap()->pGenGCHeap->heap_number);
+                BOOL org_remote_p = (heap_select::find_numa_node_from_heap_no (org_hp->heap_number) != home_node);
+
                 int start, end, finish;
-                heap_select::get_heap_range_for_heap(org_hp->heap_number, &start, &end);
+                heap_select::get_heap_range_for_heap(acontext->get_home_heap()->pGenGCHeap->heap_number, &start, &end);
                 finish = start + n_heaps;
 
 try_again:
                 do
                 {
                     max_hp = org_hp;
-                    max_size = org_size + delta;
-                    acontext->set_home_heap(GCHeap::GetHeap( heap_select::select_heap(acontext, hint) ));
+                    // Staying on a heap on a remote node keeps the cross node traffic going 
+                    // so it doesn't get the bonus for staying put - moving back is favored instead.
+                    max_size = (org_remote_p ? (org_size - delta) : (org_size + delta));
+                    acontext->set_home_heap(GCHeap::GetHeap( heap_select::select_heap(acontext, hint) % n_active_heaps ));
 
                     if (org_hp == acontext->get_home_heap()->pGenGCHeap)
                         max_size = max_size + delta;
@@ -13572,6 +14003,8 @@ try_again:
                     for (int i = start; i < end; i++)
                     {
                         gc_heap* hp = GCHeap::GetHeap(i%n_heaps)->pGenGCHeap;
+                        if (hp->heap_number >= n_active_heaps)
+                            continue;
                         dd = hp->dynamic_data_of (0);
                         ptrdiff_t size = dd_new_allocation (dd);
                         if (hp == acontext->get_home_heap()->pGenGCHeap)
@@ -13602,6 +14035,10 @@ try_again:
                     org_hp->alloc_context_count--;
                     max_hp->alloc_context_count++;
                     acontext->set_alloc_heap(GCHeap::GetHeap(max_hp->heap_number));
+                    if (heap_select::find_numa_node_from_heap_no (max_hp->heap_number) == home_node)
+                        Interlocked::Increment (&max_hp->alloc_context_local_switches);
+                    else
+                        Interlocked::Increment (&max_hp->alloc_context_remote_switches);
                     if (!gc_thread_no_affinitize_p)
                     {
                         uint16_t src_proc_no = heap_select::find_proc_no_from_heap_no(org_hp->heap_number);
@@ -13631,6 +14068,51 @@ try_again:
     acontext->alloc_count++;
 }
 
+// Fires an event per NUMA node with what was allocated on its heaps and how many 
+// allocation contexts balance_heaps moved to them (from the same node or another 
+// node) since the last GC. Heaps on the same node are always numbered contiguously.
+void gc_heap::fire_numa_node_alloc_events()
+{
+    bool fire_p = EVENT_ENABLED(GCNumaNodeAllocStats);
+    uint64_t node_alloc_bytes = 0;
+    uint32_t node_local_switches = 0;
+    uint32_t node_remote_switches = 0;
+
+    for (int i = 0; i < n_heaps; i++)
+    {
+        gc_heap* hp = g_heaps[i];
+        uint64_t total_alloc_bytes = hp->total_alloc_bytes_soh + hp->total_alloc_bytes_loh;
+        node_alloc_bytes += total_alloc_bytes - hp->last_numa_event_alloc_bytes;
+        node_local_switches += (uint32_t)hp->alloc_context_local_switches;
+        node_remote_switches += (uint32_t)hp->alloc_context_remote_switches;
+
+        hp->last_numa_event_alloc_bytes = total_alloc_bytes;
+        hp->alloc_context_local_switches = 0;
+        hp->alloc_context_remote_switches = 0;
+
+        uint16_t node = heap_select::find_numa_node_from_heap_no (i);
+        if ((i == (n_heaps - 1)) || (heap_select::find_numa_node_from_heap_no (i + 1) != node))
+        {
+            dprintf (3, ("GC#%Id node %d: allocated %I64d, switches local %d remote %d",
+                (size_t)settings.gc_index, node, node_alloc_bytes, node_local_switches, node_remote_switches));
+
+            if (fire_p)
+            {
+                FIRE_EVENT(GCNumaNodeAllocStats,
+                           (uint32_t)settings.gc_index,
+                           (uint32_t)node,
+                           node_alloc_bytes,
+                           node_local_switches,
+                           node_remote_switches);
+            }
+
+            node_alloc_bytes = 0;
+            node_local_switches = 0;
+            node_remote_switches = 0;
+        }
+    }
+}
+
 ptrdiff_t gc_heap::get_balance_heaps_loh_effective_budget ()
 {
     if (heap_hard_limit)
@@ -13651,7 +14133,7 @@ ptrdiff_t gc_heap::get_balance_heaps_loh_effective_budget ()
 
 gc_heap* gc_heap::balance_heaps_loh (alloc_context* acontext, size_t alloc_size)
 {
-    const int home_hp_num = heap_select::select_heap(acontext, 0);
+    const int home_hp_num = heap_select::select_heap(acontext, 0) % n_active_heaps;
     dprintf (3, ("[h%d] LA: %Id", home_heap, alloc_size));
     gc_heap* home_hp = GCHeap::GetHeap(home_hp_num)->pGenGCHeap;
     dynamic_data* dd = home_hp->dynamic_data_of (max_generation + 1);
@@ -13673,6 +14155,8 @@ try_again:
     for (int i = start; i < end; i++)
     {
         gc_heap* hp = GCHeap::GetHeap(i%n_heaps)->pGenGCHeap;
+        if (hp->heap_number >= n_active_heaps)
+            continue;
         const ptrdiff_t size = hp->get_balance_heaps_loh_effective_budget ();
 
         dprintf (3, ("hp: %d, size: %d", hp->heap_number, size));
@@ -13742,6 +14226,59 @@ try_again:
 
     return max_hp;
 }
+
+// Called at the end of each blocking GC with all heaps joined. We measure how much
+// of the elapsed time we've spent in blocking GCs over a window of GCs - if GCs are
+// too costly we allow allocations on more heaps which gives us more total gen0
+// budget (and so fewer GCs); if they are cheap we stop allocating on some heaps so
+// the memory they are holding on to can be given back.
+void gc_heap::check_dynamic_heap_count ()
+{
+    if (!dynamic_heap_count_p)
+        return;
+
+    const size_t sample_gc_count = 20;
+    const size_t high_gc_time_percent = 5;
+    const size_t low_gc_time_percent = 1;
+
+    size_t now = GetHighPrecisionTimeStamp ();
+    dynamic_heap_count_gc_time += dd_gc_elapsed_time (g_heaps[0]->dynamic_data_of (settings.condemned_generation));
+    dynamic_heap_count_gc_count++;
+
+    if (dynamic_heap_count_start_time == 0)
+    {
+        dynamic_heap_count_start_time = now;
+        dynamic_heap_count_gc_time = 0;
+        dynamic_heap_count_gc_count = 0;
+        return;
+    }
+
+    if (dynamic_heap_count_gc_count < sample_gc_count)
+        return;
+
+    size_t elapsed_time = now - dynamic_heap_count_start_time;
+    size_t gc_time_percent = (elapsed_time ? (dynamic_heap_count_gc_time * 100 / elapsed_time) : 100);
+    int new_n_active_heaps = n_active_heaps;
+
+    if (gc_time_percent > high_gc_time_percent)
+    {
+        new_n_active_heaps = min (n_heaps, (n_active_heaps * 2));
+    }
+    else if (gc_time_percent < low_gc_time_percent)
+    {
+        new_n_active_heaps = max (1, (n_active_heaps - max (1, (n_active_heaps / 4))));
+    }
+
+    dprintf (GTC_LOG, ("%Id GCs took %Idms in %Idms (%Id%%), active heaps %d->%d",
+        dynamic_heap_count_gc_count, dynamic_heap_count_gc_time, elapsed_time, gc_time_percent,
+        n_active_heaps, new_n_active_heaps));
+
+    n_active_heaps = new_n_active_heaps;
+
+    dynamic_heap_count_start_time = now;
+    dynamic_heap_count_gc_time = 0;
+    dynamic_heap_count_gc_count = 0;
+}
 #endif //MULTIPLE_HEAPS
 
 BOOL gc_heap::allocate_more_space(alloc_context* acontext, size_t size,
@@ -13779,6 +14316,11 @@ BOOL gc_heap::allocate_more_space(alloc_context* acontext, size_t size,
             }
         }
 #else
+        // balance_heaps does this for server GC.
+        if (alloc_generation_number == 0)
+        {
+            acontext->alloc_count++;
+        }
         status = try_allocate_more_space (acontext, size, flags, alloc_generation_number);
 #endif //MULTIPLE_HEAPS
     }
@@ -13996,51 +14538,101 @@ uint8_t* gc_heap::allocate_in_older_generation (generation* gen, size_t size,
     if (! (size_fit_p (size REQD_ALIGN_AND_OFFSET_ARG, generation_allocation_pointer (gen),
                        generation_allocation_limit (gen), old_loc, USE_PADDING_TAIL | pad_in_front)))
     {
-        size_t sz_list = gen_allocator->first_bucket_size();
-        for (unsigned int a_l_idx = 0; a_l_idx < gen_allocator->number_of_buckets(); a_l_idx++)
+        // The bucket 2*real_size falls into is the first one whose items are all larger 
+        // than real_size, so from there on we take the first item that fits. Items can still
+        // fail to fit because of alignment and padding, and bucket 0 (no lower bound) or the
+        // last bucket (where larger sizes are capped to) may hold items smaller than real_size.
+        unsigned int first_fit_idx = gen_allocator->first_suitable_bucket (real_size * 2);
+
+        if (!discard_p)
         {
-            if ((real_size < (sz_list / 2)) || (a_l_idx == (gen_allocator->number_of_buckets()-1)))
+            // Items in the bucket real_size itself falls into may or may not fit. Rather 
+            // than leaving them all to fragment we look at a bounded number of them and 
+            // take the smallest that fits.
+            unsigned int best_fit_idx = gen_allocator->first_suitable_bucket (real_size);
+            if ((best_fit_idx > 0) && (best_fit_idx < first_fit_idx))
             {
-                uint8_t* free_list = gen_allocator->alloc_list_head_of (a_l_idx);
+                uint8_t* best_free_item = 0;
+                uint8_t* best_prev_free_item = 0;
+                size_t best_free_item_size = 0;
+
+                uint8_t* free_list = gen_allocator->alloc_list_head_of (best_fit_idx);
                 uint8_t* prev_free_item = 0;
-                while (free_list != 0)
+                int items_considered = 0;
+                while ((free_list != 0) && (items_considered < MAX_BEST_FIT_CANDIDATES))
                 {
-                    dprintf (3, ("considering free list %Ix", (size_t)free_list));
-
                     size_t free_list_size = unused_array_size (free_list);
 
-                    if (size_fit_p (size REQD_ALIGN_AND_OFFSET_ARG, free_list, (free_list + free_list_size),
+                    if (((best_free_item == 0) || (free_list_size < best_free_item_size)) &&
+                        size_fit_p (size REQD_ALIGN_AND_OFFSET_ARG, free_list, (free_list + free_list_size),
                                     old_loc, USE_PADDING_TAIL | pad_in_front))
                     {
-                        dprintf (4, ("F:%Ix-%Id",
-                                     (size_t)free_list, free_list_size));
+                        best_free_item = free_list;
+                        best_prev_free_item = prev_free_item;
+                        best_free_item_size = free_list_size;
+                    }
 
-                        gen_allocator->unlink_item (a_l_idx, free_list, prev_free_item, !discard_p);
-                        generation_free_list_space (gen) -= free_list_size;
-                        remove_gen_free (gen->gen_num, free_list_size);
+                    items_considered++;
+                    prev_free_item = free_list;
+                    free_list = free_list_slot (free_list);
+                }
 
-                        adjust_limit (free_list, free_list_size, gen, from_gen_number+1);
-                        generation_allocate_end_seg_p (gen) = FALSE;
-                        goto finished;
-                    }
-                    // We do first fit on bucket 0 because we are not guaranteed to find a fit there.
-                    else if (discard_p || (a_l_idx == 0))
-                    {
-                        dprintf (3, ("couldn't use this free area, discarding"));
-                        generation_free_obj_space (gen) += free_list_size;
+                if (best_free_item)
+                {
+                    dprintf (4, ("BF:%Ix-%Id (%d considered)",
+                                 (size_t)best_free_item, best_free_item_size, items_considered));
 
-                        gen_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
-                        generation_free_list_space (gen) -= free_list_size;
-                        remove_gen_free (gen->gen_num, free_list_size);
-                    }
-                    else
-                    {
-                        prev_free_item = free_list;
-                    }
-                    free_list = free_list_slot (free_list); 
+                    gen_allocator->unlink_item (best_fit_idx, best_free_item, best_prev_free_item, TRUE);
+                    generation_free_list_space (gen) -= best_free_item_size;
+                    remove_gen_free (gen->gen_num, best_free_item_size);
+
+                    adjust_limit (best_free_item, best_free_item_size, gen, from_gen_number+1);
+                    generation_allocate_end_seg_p (gen) = FALSE;
+                    goto finished;
                 }
             }
-            sz_list = sz_list * 2;
+        }
+
+        for (unsigned int a_l_idx = first_fit_idx; a_l_idx < gen_allocator->number_of_buckets(); a_l_idx++)
+        {
+            uint8_t* free_list = gen_allocator->alloc_list_head_of (a_l_idx);
+            uint8_t* prev_free_item = 0;
+            while (free_list != 0)
+            {
+                dprintf (3, ("considering free list %Ix", (size_t)free_list));
+
+                size_t free_list_size = unused_array_size (free_list);
+
+                if (size_fit_p (size REQD_ALIGN_AND_OFFSET_ARG, free_list, (free_list + free_list_size),
+                                old_loc, USE_PADDING_TAIL | pad_in_front))
+                {
+                    dprintf (4, ("F:%Ix-%Id",
+                                 (size_t)free_list, free_list_size));
+
+                    gen_allocator->unlink_item (a_l_idx, free_list, prev_free_item, !discard_p);
+                    generation_free_list_space (gen) -= free_list_size;
+                    remove_gen_free (gen->gen_num, free_list_size);
+
+                    adjust_limit (free_list, free_list_size, gen, from_gen_number+1);
+                    generation_allocate_end_seg_p (gen) = FALSE;
+                    goto finished;
+                }
+                // We do first fit on bucket 0 because we are not guaranteed to find a fit there.
+                else if (discard_p || (a_l_idx == 0))
+                {
+                    dprintf (3, ("couldn't use this free area, discarding"));
+                    generation_free_obj_space (gen) += free_list_size;
+
+                    gen_allocator->unlink_item (a_l_idx, free_list, prev_free_item, FALSE);
+                    generation_free_list_space (gen) -= free_list_size;
+                    remove_gen_free (gen->gen_num, free_list_size);
+                }
+                else
+                {
+                    prev_free_item = free_list;
+                }
+                free_list = free_list_slot (free_list); 
+            }
         }
         //go back to the beginning of the segment list 
         heap_segment* seg = heap_segment_rw (generation_start_segment (gen));
@@ -14800,10 +15392,13 @@ int gc_heap::joined_generation_to_condemn (BOOL should_evaluate_elevation,
     if (heap_hard_limit)
     {
         // If we have already consumed 90% of the limit, we should check to see if we should compact LOH.
+        // With a LOH limit only the LOH commit counts towards that.
         // TODO: should unify this with gen2.
+        size_t limit = get_hard_limit_for (oh_loh);
+        size_t committed = get_committed_for (oh_loh);
         dprintf (GTC_LOG, ("committed %Id is %d%% of limit %Id", 
-            current_total_committed, (int)((float)current_total_committed * 100.0 / (float)heap_hard_limit),
-            heap_hard_limit));
+            committed, (int)((float)committed * 100.0 / (float)limit),
+            limit));
 
         bool full_compact_gc_p = false;
 
@@ -14811,14 +15406,14 @@ int gc_heap::joined_generation_to_condemn (BOOL should_evaluate_elevation,
         {
             full_compact_gc_p = true;
         }
-        else if ((current_total_committed * 10) >= (heap_hard_limit * 9))
+        else if ((committed * 10) >= (limit * 9))
         {
             size_t loh_frag = get_total_gen_fragmentation (max_generation + 1);
             
             // If the LOH frag is >= 1/8 it's worth compacting it
-            if ((loh_frag * 8) >= heap_hard_limit)
+            if ((loh_frag * 8) >= limit)
             {
-                dprintf (GTC_LOG, ("loh frag: %Id > 1/8 of limit %Id", loh_frag, (heap_hard_limit / 8)));
+                dprintf (GTC_LOG, ("loh frag: %Id > 1/8 of limit %Id", loh_frag, (limit / 8)));
                 full_compact_gc_p = true;
             }
             else
@@ -14826,8 +15421,8 @@ int gc_heap::joined_generation_to_condemn (BOOL should_evaluate_elevation,
                 // If there's not much fragmentation but it looks like it'll be productive to
                 // collect LOH, do that.
                 size_t est_loh_reclaim = get_total_gen_estimated_reclaim (max_generation + 1);
-                full_compact_gc_p = ((est_loh_reclaim * 8) >= heap_hard_limit);
-                dprintf (GTC_LOG, ("loh est reclaim: %Id, 1/8 of limit %Id", est_loh_reclaim, (heap_hard_limit / 8)));
+                full_compact_gc_p = ((est_loh_reclaim * 8) >= limit);
+                dprintf (GTC_LOG, ("loh est reclaim: %Id, 1/8 of limit %Id", est_loh_reclaim, (limit / 8)));
             }
         }
 
@@ -14840,6 +15435,19 @@ int gc_heap::joined_generation_to_condemn (BOOL should_evaluate_elevation,
         }
     }
 
+    if ((n < max_generation) && (settings.pause_mode != pause_low_latency) &&
+#ifdef BACKGROUND_GC
+        !recursive_gc_sync::background_running_p() &&
+#endif //BACKGROUND_GC
+        conserve_mem_frag_exceeded_p())
+    {
+        // A BGC would only sweep so make this blocking; decide_on_compacting 
+        // does the rest.
+        dprintf (GTC_LOG, ("gen2 frag above conserve memory target, doing a compacting gen2"));
+        n = max_generation;
+        *blocking_collection_p = TRUE;
+    }
+
     if ((n == max_generation) && (*blocking_collection_p == FALSE))
     {
         // If we are doing a gen2 we should reset elevation regardless and let the gen2
@@ -15261,8 +15869,20 @@ int gc_heap::generation_to_condemn (int n_initial,
         entry_available_physical_mem = available_physical;
         local_settings->entry_memory_load = memory_load;
 
+        // In a cgroup we can be throttled and reclaimed from well before the memory load looks 
+        // high, the stall info tells us when that's happening.
+        BOOL memory_stall_p = FALSE;
+        uint32_t memory_stall = 0;
+        if ((memory_pressure_stall_th != 0) && 
+            GCToOSInterface::GetMemoryPressure (&memory_stall) &&
+            (memory_stall >= memory_pressure_stall_th))
+        {
+            dprintf (GTC_LOG, ("h%d: memory stall %d%%", heap_number, memory_stall));
+            memory_stall_p = TRUE;
+        }
+
         // @TODO: Force compaction more often under GCSTRESS
-        if (memory_load >= high_memory_load_th || low_memory_detected)
+        if (memory_load >= high_memory_load_th || low_memory_detected || memory_stall_p)
         {
 #ifdef SIMPLE_DPRINTF
             // stress log can't handle any parameter that's bigger than a void*.
@@ -15274,7 +15894,7 @@ int gc_heap::generation_to_condemn (int n_initial,
 
             high_memory_load = TRUE;
 
-            if (memory_load >= v_high_memory_load_th || low_memory_detected)
+            if (memory_load >= v_high_memory_load_th || low_memory_detected || memory_stall_p)
             {
                 // TODO: Perhaps in 64-bit we should be estimating gen1's fragmentation as well since
                 // gen1/gen0 may take a lot more memory than gen2.
@@ -15431,7 +16051,9 @@ int gc_heap::generation_to_condemn (int n_initial,
         {
             dprintf (GTC_LOG, ("h%d: g%d too frag", heap_number, n));
             local_condemn_reasons->set_condition (gen_max_high_frag_p);
-            if (local_settings->pause_mode != pause_sustained_low_latency)
+            // With a pause target we'd rather let a background GC deal with it than do
+            // a full blocking GC that's going to blow the target.
+            if ((local_settings->pause_mode != pause_sustained_low_latency) && (pause_target_ms == 0))
             {
                 *blocking_collection_p = TRUE;
             }
@@ -16067,6 +16689,8 @@ void gc_heap::gc1()
         {
             gc_heap::internal_gc_done = false;
 
+            check_dynamic_heap_count();
+
             //equalize the new desired size of the generations
             int limit = settings.condemned_generation;
             if (limit == max_generation)
@@ -18936,6 +19560,13 @@ next_level:
 #endif // COLLECTIBLE_CLASS
         allow_fgc();
 
+#ifdef MULTIPLE_HEAPS
+        if (bgc_idle_thread_count > 0)
+        {
+            bgc_share_mark_stack();
+        }
+#endif //MULTIPLE_HEAPS
+
         if (!(background_mark_stack_tos == background_mark_stack_array))
         {
             oo = *(--background_mark_stack_tos);
@@ -18953,6 +19584,130 @@ next_level:
 
 }
 
+#ifdef MULTIPLE_HEAPS
+// If other BGC threads are done with their own marking, hand them some of the
+// oldest entries on our mark stack - these tend to be the roots of the biggest 
+// subgraphs that are left. Entries we take are zeroed out in place which the
+// marking loop already treats as empty, so we don't need to shuffle the stack.
+// Partial mark entries are left alone since they refer to the inside of an 
+// object we are in the middle of marking.
+void gc_heap::bgc_share_mark_stack()
+{
+    size_t depth = background_mark_stack_tos - background_mark_stack_array;
+    if ((bgc_share_count != 0) || (depth < 2))
+        return;
+
+    if (!try_enter_spin_lock (&bgc_share_lock))
+        return;
+
+    size_t to_share = min ((size_t)BGC_SHARE_BUFFER_LENGTH, (depth / 2));
+    uint8_t** finger = background_mark_stack_array;
+    uint8_t** limit = background_mark_stack_array + to_share;
+    size_t shared = bgc_share_count;
+
+    while ((finger < limit) && (shared < BGC_SHARE_BUFFER_LENGTH))
+    {
+        if (((finger + 1) < background_mark_stack_tos) && ((size_t)*(finger + 1) & 1))
+        {
+            // skip the partial mark tuple.
+            finger += 2;
+            continue;
+        }
+
+        if (*finger)
+        {
+            bgc_share_buffer[shared++] = *finger;
+            *finger = 0;
+        }
+        finger++;
+    }
+
+    dprintf (3, ("h%d: shared %Id mark stack entries (depth %Id)", heap_number, (shared - bgc_share_count), depth));
+    bgc_share_count = shared;
+    leave_spin_lock (&bgc_share_lock);
+}
+
+// Called by a BGC thread that is done with its concurrent marking - instead of 
+// waiting at the next join for the heaps with much bigger object graphs we mark
+// what those heaps' BGC threads shared with us. We are done when every BGC thread
+// is idle and there is nothing left to share. Note that we never decrement the
+// idle count when leaving - the owner of a share buffer is the only one who fills
+// it and it always drains it before it leaves so nothing shared can be lost.
+// The count is reset at the next join.
+void gc_heap::bgc_mark_steal()
+{
+    int thread = heap_number;
+    Interlocked::Increment (&bgc_idle_thread_count);
+
+    // Like mark_steal, back off more the longer we've been idle - the user threads
+    // are running alongside us.
+    int idle_loop_count = 0;
+
+    while (1)
+    {
+        BOOL found_p = FALSE;
+        for (int i = 0; i < n_heaps; i++)
+        {
+            gc_heap* hp = g_heaps[(heap_number + i) % n_heaps];
+            if ((hp->bgc_share_count == 0) || !try_enter_spin_lock (&hp->bgc_share_lock))
+                continue;
+
+            uint8_t* o = 0;
+            if (hp->bgc_share_count != 0)
+            {
+                o = hp->bgc_share_buffer[--(hp->bgc_share_count)];
+                // We are busy again - do this before we let go of the lock so 
+                // no one can see all threads as idle with work still in flight.
+                Interlocked::Decrement (&bgc_idle_thread_count);
+            }
+            leave_spin_lock (&hp->bgc_share_lock);
+
+            if (o)
+            {
+                dprintf (3, ("h%d: marking %Ix shared by h%d", heap_number, (size_t)o, hp->heap_number));
+                // o was already marked when it got onto the mark stack.
+                background_mark_simple1 (o THREAD_NUMBER_ARG);
+                Interlocked::Increment (&bgc_idle_thread_count);
+                found_p = TRUE;
+                idle_loop_count = 0;
+                break;
+            }
+        }
+
+        if (!found_p)
+        {
+            if (bgc_idle_thread_count >= n_heaps)
+            {
+                BOOL all_empty_p = TRUE;
+                for (int i = 0; i < n_heaps; i++)
+                {
+                    if (g_heaps[i]->bgc_share_count != 0)
+                    {
+                        all_empty_p = FALSE;
+                        break;
+                    }
+                }
+
+                if (all_empty_p)
+                    break;
+            }
+
+            allow_fgc();
+
+            idle_loop_count++;
+            if ((idle_loop_count % (6)) == 1)
+            {
+                GCToOSInterface::YieldThread (0);
+            }
+            else
+            {
+                YieldProcessor();
+            }
+        }
+    }
+}
+#endif //MULTIPLE_HEAPS
+
 //this version is different than the foreground GC because
 //it can't keep pointers to the inside of an object
 //while calling background_mark_simple1. The object could be moved
@@ -19157,6 +19912,16 @@ gc_heap::scan_background_roots (promote_func* fn, int hn, ScanContext *pSC)
         (*fn) ((Object**)finger, pSC, 0);
         finger++;
     }
+
+#ifdef MULTIPLE_HEAPS
+    dprintf (3, ("Scanning background mark share buffer"));
+
+    for (size_t i = 0; i < bgc_share_count; i++)
+    {
+        dprintf(3,("background shared root %Ix", (size_t)bgc_share_buffer[i]));
+        (*fn) ((Object**)&bgc_share_buffer[i], pSC, 0);
+    }
+#endif //MULTIPLE_HEAPS
 }
 
 inline
@@ -19562,6 +20327,52 @@ size_t gc_heap::get_total_gen_fragmentation (int gen_number)
     return total_fragmentation;
 }
 
+size_t gc_heap::get_total_gen_size (int gen_number)
+{
+    size_t total_size = 0;
+
+#ifdef MULTIPLE_HEAPS
+    for (int hn = 0; hn < gc_heap::n_heaps; hn++)
+    {
+        gc_heap* hp = gc_heap::g_heaps[hn];
+#else //MULTIPLE_HEAPS
+    {
+        gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+        total_size += hp->generation_size (gen_number);
+    }
+
+    return total_size;
+}
+
+// We only check this once gen2 has used up half its budget since the last gen2 -
+// if compacting couldn't get rid of the fragmentation (eg, because of pinning) 
+// we don't want to keep doing full GCs.
+BOOL gc_heap::conserve_mem_frag_exceeded_p ()
+{
+    if (!conserve_mem_frag_target)
+        return FALSE;
+
+#ifdef MULTIPLE_HEAPS
+    dynamic_data* dd2 = g_heaps[0]->dynamic_data_of (max_generation);
+#else
+    dynamic_data* dd2 = dynamic_data_of (max_generation);
+#endif //MULTIPLE_HEAPS
+
+    if ((dd_new_allocation (dd2) * 2) > (ptrdiff_t)dd_desired_allocation (dd2))
+        return FALSE;
+
+    size_t gen2_frag = get_total_gen_fragmentation (max_generation);
+    size_t gen2_size = get_total_gen_size (max_generation);
+    BOOL exceeded_p = ((gen2_frag * 100) > (gen2_size * (size_t)conserve_mem_frag_target));
+
+    dprintf (GTC_LOG, ("gen2 frag %Id / size %Id is %d%%, target %d%%",
+        gen2_frag, gen2_size, (gen2_size ? (int)(gen2_frag * 100 / gen2_size) : 0), 
+        conserve_mem_frag_target));
+
+    return exceeded_p;
+}
+
 size_t gc_heap::get_total_gen_estimated_reclaim (int gen_number)
 {
     size_t total_estimated_reclaim = 0;
@@ -19900,6 +20711,11 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
         gc_t_join.join(this, gc_join_rescan_dependent_handles);
         if (gc_t_join.joined())
         {
+            if (GCScan::GcHandleScanStealing())
+            {
+                GCScan::GcBeginHandleScanPass (true);
+            }
+
             // Restart all the workers.
             dprintf(3, ("Starting all gc thread for dependent handle promotion"));
             gc_t_join.restart();
@@ -19907,8 +20723,9 @@ void gc_heap::scan_dependent_handles (int condemned_gen_number, ScanContext *sc,
 
         // If the portion of the dependent handle table managed by this worker has handles that could still be
         // promoted perform a rescan. If the rescan resulted in at least one promotion note this fact since it
-        // could require a rescan of handles on this or other workers.
-        if (GCScan::GcDhUnpromotedHandlesExist(sc))
+        // could require a rescan of handles on this or other workers. When the tables are split between the
+        // workers each table's scanner isn't known until the scan, so everyone has to take part.
+        if (GCScan::GcHandleScanStealing() || GCScan::GcDhUnpromotedHandlesExist(sc))
             if (GCScan::GcDhReScan(sc))
                 s_fUnscannedPromotions = TRUE;
     }
@@ -20036,6 +20853,10 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
 
         num_sizedrefs = GCToEEInterface::GetTotalNumSizedRefHandles();
 
+#ifdef MARK_LIST
+        grow_mark_list();
+#endif //MARK_LIST
+
 #ifdef MULTIPLE_HEAPS
 
 #ifdef MH_SC_MARK
@@ -20058,6 +20879,25 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
         }
 #endif //MH_SC_MARK
 
+#ifdef CARD_MARKING_STEALING
+        // We can't claim other heaps' chunks while a BGC is in progress because 
+        // whether an object needs to be considered depends on the owning heap's
+        // sweep state.
+        card_marking_stealing_p = (!full_p
+#ifdef BACKGROUND_GC
+                                   && !recursive_gc_sync::background_running_p()
+#endif //BACKGROUND_GC
+                                   );
+        for (int i = 0; i < n_heaps; i++)
+        {
+            g_heaps[i]->card_marking_chunk_index = 0;
+        }
+#endif //CARD_MARKING_STEALING
+
+        // Strong and dependent handle promotion for this GC can be split across the GC threads
+        // at handle table granularity, instead of each thread only scanning its own heap's slot.
+        GCScan::GcBeginHandleScanPass (true);
+
         gc_t_join.restart();
     }
 #endif //MULTIPLE_HEAPS
@@ -20274,6 +21114,9 @@ void gc_heap::mark_phase (int condemned_gen_number, BOOL mark_only_p)
     gc_t_join.join(this, gc_join_null_dead_long_weak);
     if (gc_t_join.joined())
     {
+        // Background GC scans handles by slot.
+        GCScan::GcBeginHandleScanPass (false);
+
         //start all threads on the roots.
         dprintf(3, ("Starting all gc thread for weak pointer deletion"));
         gc_t_join.restart();
@@ -21454,6 +22297,13 @@ BOOL gc_heap::plan_loh()
             size_t size = AlignQword (size (o));
             dprintf (1235, ("%Ix(%Id) M", o, size));
 
+            if (heap_segment_poh_p (seg) && !pinned (o))
+            {
+                // Everything on a pinned segment stays where it is. Setting the
+                // pinned bit makes compact_loh treat it like any other pinned plug.
+                set_pinned (o);
+            }
+
             if (pinned (o))
             {
                 // We don't clear the pinned bit yet so we can check in 
@@ -21925,6 +22775,12 @@ void gc_heap::plan_phase (int condemned_gen_number)
                  (mark_list_index - &mark_list[0])));
 #endif //GC_CONFIG_DRIVEN
 
+    if ((condemned_gen_number < max_generation) && (mark_list_index > mark_list_end))
+    {
+        // several heaps can get here at the same time but they all store the same value.
+        mark_list_overflow = TRUE;
+    }
+
     if ((condemned_gen_number < max_generation) &&
         (mark_list_index <= mark_list_end) 
 #ifdef BACKGROUND_GC        
@@ -25848,7 +26704,8 @@ BOOL gc_heap::commit_mark_array_by_range (uint8_t* begin, uint8_t* end, uint32_t
                             size));
 #endif //SIMPLE_DPRINTF
 
-    if (virtual_commit (commit_start, size))
+    // With large pages the whole mark array was committed (and accounted for) with the card table.
+    if (on_bookkeeping_large_pages_p (commit_start, size) || virtual_commit (commit_start, size, oh_none))
     {
         // We can only verify the mark array is cleared from begin to end, the first and the last
         // page aren't necessarily all cleared 'cause they could be used by other segments or 
@@ -26091,9 +26948,15 @@ void gc_heap::decommit_mark_array_by_seg (heap_segment* seg)
                                 size));
 #endif //SIMPLE_DPRINTF
         
-        if (decommit_start < decommit_end)
+        if ((decommit_start < decommit_end) && on_bookkeeping_large_pages_p (decommit_start, size))
         {
-            if (!virtual_decommit (decommit_start, size))
+            // Large pages can't be decommitted; clear it instead since a recommit
+            // would have given us zeroed pages.
+            memclr (decommit_start, size);
+        }
+        else if (decommit_start < decommit_end)
+        {
+            if (!virtual_decommit (decommit_start, size, oh_none))
             {
                 dprintf (GC_TABLE_LOG, ("decommit on %Ix for %Id bytes failed", 
                                         decommit_start, size));
@@ -26137,6 +27000,7 @@ void gc_heap::background_mark_phase ()
 
     background_soh_alloc_count = 0;
     background_loh_alloc_count = 0;
+    loh_sweep_concurrent_p = false;
     bgc_overflow_count = 0;
 
     bpromoted_bytes (heap_number) = 0;
@@ -26347,12 +27211,19 @@ void gc_heap::background_mark_phase ()
         //concurrent_print_time_delta ("concurrent marking dirtied pages on LOH");
         concurrent_print_time_delta ("CRre");
 
+#ifdef MULTIPLE_HEAPS
+        bgc_mark_steal();
+        concurrent_print_time_delta ("CRsteal");
+#endif //MULTIPLE_HEAPS
+
         enable_preemptive ();
 
 #ifdef MULTIPLE_HEAPS
         bgc_t_join.join(this, gc_join_concurrent_overflow);
         if (bgc_t_join.joined())
         {
+            bgc_idle_thread_count = 0;
+
             uint8_t* all_heaps_max = 0;
             uint8_t* all_heaps_min = MAX_PTR;
             int i;
@@ -28230,6 +29101,91 @@ BOOL gc_heap::card_transition (uint8_t* po, uint8_t* end, size_t card_word_end,
     return passed_end_card_p;
 }
 
+#ifdef CARD_MARKING_STEALING
+// Gets the next range of SOH objects to mark through cards for when card marking
+// work is shared between heaps. We first claim chunks of our own gen2 segments 
+// (other than the ephemeral one), then do our ephemeral segment, and then claim
+// whatever chunks are left on the other heaps, so a heap with a heavily written gen2
+// segment doesn't hold up everyone else. heap_offset is the offset from our heap
+// number of the heap we are claiming from. Returns FALSE when there's nothing left.
+//
+// Chunk boundaries are on card word boundaries so threads never clear cards in the 
+// same card word. beg is where the chunk starts and first_object is the object that
+// contains beg, which can start in the previous chunk.
+BOOL gc_heap::find_next_card_marking_chunk (heap_segment*& seg, uint8_t*& beg, uint8_t*& end, 
+                                            uint8_t*& first_object, int& heap_offset, 
+                                            BOOL& eph_seg_done_p)
+{
+    while (1)
+    {
+        if ((heap_offset > 0) && !eph_seg_done_p)
+        {
+            generation* oldest_gen = generation_of (max_generation);
+            seg = ephemeral_heap_segment;
+            beg = ((seg == heap_segment_rw (generation_start_segment (oldest_gen))) ?
+                   generation_allocation_start (oldest_gen) : heap_segment_mem (seg));
+            end = compute_next_end (seg, gc_low);
+            first_object = beg;
+            eph_seg_done_p = TRUE;
+            return TRUE;
+        }
+
+        if (heap_offset >= n_heaps)
+        {
+            return FALSE;
+        }
+
+        gc_heap* hp = g_heaps[(heap_number + heap_offset) % n_heaps];
+        size_t chunk_index = (size_t)(Interlocked::Increment (&hp->card_marking_chunk_index) - 1);
+
+        generation* oldest_gen = hp->generation_of (max_generation);
+        heap_segment* start_seg = heap_segment_rw (generation_start_segment (oldest_gen));
+        heap_segment* chunk_seg = start_seg;
+        while (chunk_seg)
+        {
+            if (chunk_seg != hp->ephemeral_heap_segment)
+            {
+                uint8_t* seg_start = heap_segment_mem (chunk_seg);
+                uint8_t* seg_end = heap_segment_allocated (chunk_seg);
+                // The granularity is a multiple of the card word size so all chunk 
+                // boundaries after this are card word aligned too.
+                uint8_t* chunk_base = align_lower_card_word (seg_start);
+                size_t num_chunks = ((seg_end - chunk_base) + CARD_MARKING_STEALING_GRANULARITY - 1) / 
+                                    CARD_MARKING_STEALING_GRANULARITY;
+
+                if (chunk_index < num_chunks)
+                {
+                    seg = chunk_seg;
+                    beg = chunk_base + chunk_index * CARD_MARKING_STEALING_GRANULARITY;
+                    end = min (seg_end, (beg + CARD_MARKING_STEALING_GRANULARITY));
+                    if (chunk_index == 0)
+                    {
+                        beg = ((chunk_seg == start_seg) ? 
+                               generation_allocation_start (oldest_gen) : seg_start);
+                        first_object = beg;
+                    }
+                    else
+                    {
+                        // The chunk boundary may be in the middle of an object.
+                        first_object = find_first_object (beg, seg_start);
+                    }
+
+                    dprintf (3, ("h%d: card marking chunk %Id of h%d: [%Ix, %Ix[", 
+                        heap_number, chunk_index, hp->heap_number, (size_t)beg, (size_t)end));
+                    return TRUE;
+                }
+
+                chunk_index -= num_chunks;
+            }
+
+            chunk_seg = heap_segment_next_in_range (chunk_seg);
+        }
+
+        heap_offset++;
+    }
+}
+#endif //CARD_MARKING_STEALING
+
 void gc_heap::mark_through_cards_for_segments (card_fn fn, BOOL relocating)
 {
 #ifdef BACKGROUND_GC
@@ -28279,6 +29235,21 @@ void gc_heap::mark_through_cards_for_segments (card_fn fn, BOOL relocating)
     BOOL          foundp            = FALSE;
     uint8_t*      start_address     = 0;
     uint8_t*      limit             = 0;
+#ifdef CARD_MARKING_STEALING
+    // When we are claiming chunks we do all of our own chunks first, then our
+    // ephemeral segment, then chunks from the other heaps. Note that the card table
+    // efficiency ratio will then include what we've done for the other heaps.
+    BOOL          stealing_p        = (card_marking_stealing_p && !relocating);
+    BOOL          eph_seg_done_p    = FALSE;
+    int           chunk_heap_offset = 0;
+    if (stealing_p)
+    {
+        // This always succeeds since there's at least our ephemeral segment.
+        find_next_card_marking_chunk (seg, beg, end, last_object, chunk_heap_offset, eph_seg_done_p);
+        card_word_end = (card_of (align_on_card_word (end)) / card_word_width);
+    }
+#endif //CARD_MARKING_STEALING
+
     size_t        card              = card_of (beg);
 #ifdef BACKGROUND_GC
     BOOL consider_bgc_mark_p        = FALSE;
@@ -28330,6 +29301,24 @@ void gc_heap::mark_through_cards_for_segments (card_fn fn, BOOL relocating)
             }
             n_eph += cg_pointers_found;
             cg_pointers_found = 0;
+#ifdef CARD_MARKING_STEALING
+            if (stealing_p)
+            {
+                if (!find_next_card_marking_chunk (seg, beg, end, last_object, chunk_heap_offset, eph_seg_done_p))
+                {
+                    break;
+                }
+                // We may have gone through generation boundaries on our ephemeral
+                // segment; objects in the next chunk start out in gen2 again.
+                curr_gen_number = max_generation;
+                gen_boundary = generation_allocation_start (generation_of (curr_gen_number - 1));
+                next_boundary = compute_next_boundary (low, curr_gen_number, relocating);
+                card_word_end = card_of (align_on_card_word (end)) / card_word_width;
+                card = card_of (beg);
+                end_card = 0;
+                continue;
+            }
+#endif //CARD_MARKING_STEALING
             if ((seg = heap_segment_next_in_range (seg)) != 0)
             {
 #ifdef BACKGROUND_GC
@@ -30050,6 +31039,19 @@ void gc_heap::init_static_data()
         gen0_max_size = min (gen0_max_size, gen0_max_size_seg);
     }
 
+#ifdef MULTIPLE_HEAPS
+    // Apply the same 1/6th of physical memory rule get_gen0_min_size uses to the total of the max
+    // budgets, so many heaps on a machine (or container) with little memory each get a smaller gen0.
+    // We never go below the min budget here.
+    size_t gen0_max_size_mem = Align ((size_t)(total_physical_mem / 6 / n_heaps));
+    if (gen0_max_size > gen0_max_size_mem)
+    {
+        size_t gen0_max_size_limited = max (gen0_max_size_mem, max (gen0_min_size, (size_t)(6*1024*1024)));
+        dprintf (GTC_LOG, ("limit gen0 max by physical mem %Id->%Id", gen0_max_size, gen0_max_size_limited));
+        gen0_max_size = min (gen0_max_size, gen0_max_size_limited);
+    }
+#endif //MULTIPLE_HEAPS
+
     size_t gen0_max_size_config = (size_t)GCConfig::GetGCGen0MaxBudget();
 
     if (gen0_max_size_config)
@@ -30280,6 +31282,16 @@ size_t gc_heap::desired_new_allocation (dynamic_data* dd,
                                           max (min_gc_size, (max_size/3)));
                 }
             }
+
+            // Ephemeral GC pauses grow with how much survives, which grows with the budget.
+            if (pause_target_budget_pct < 100)
+            {
+                size_t reduced_allocation = max (min_gc_size, 
+                                                 (size_t)((uint64_t)new_allocation * pause_target_budget_pct / 100));
+                dprintf (2, ("Reducing gen%d allocation from %Id to %Id for pause target", 
+                            gen_number, new_allocation, reduced_allocation));
+                new_allocation = reduced_allocation;
+            }
         }
 
         size_t new_allocation_ret = 
@@ -30680,12 +31692,104 @@ void gc_heap::decommit_ephemeral_segment_pages()
         slack_space = min (slack_space, new_slack_space);
     }
 
-    decommit_heap_segment_pages (ephemeral_heap_segment, slack_space);    
+#ifdef MULTIPLE_HEAPS
+    // munmap/madvise of big ranges adds directly to the pause, so unless we are short on 
+    // memory we just record how far down to decommit and let heap 0's GC thread get there
+    // in steps once the EE is running again. A BGC gets here on the BGC threads after 
+    // heap 0's GC thread has already gone back to waiting for the next GC with no 
+    // timeout, so nothing would do the steps - BGCs keep decommitting inline.
+    ephemeral_decommit_target = 0;
+    if (gradual_decommit_p && !use_large_pages_p && !g_low_memory_status &&
+#ifdef BACKGROUND_GC
+        !settings.concurrent &&
+#endif //BACKGROUND_GC
+        (settings.entry_memory_load < v_high_memory_load_th))
+    {
+        uint8_t* page_start = align_on_page (heap_segment_allocated (ephemeral_heap_segment));
+        size_t size = heap_segment_committed (ephemeral_heap_segment) - page_start;
+        size_t extra_space = align_on_page (slack_space);
+        if (size >= max ((extra_space + 2*OS_PAGE_SIZE), 100*OS_PAGE_SIZE))
+        {
+            ephemeral_decommit_target = page_start + max (extra_space, 32*OS_PAGE_SIZE);
+            gradual_decommit_in_progress_p = true;
+            dprintf (3, ("h%d: decommit target %Ix (committed %Ix)", heap_number,
+                (size_t)ephemeral_decommit_target, (size_t)heap_segment_committed (ephemeral_heap_segment)));
+        }
+    }
+    else
+#endif //MULTIPLE_HEAPS
+    {
+        decommit_heap_segment_pages (ephemeral_heap_segment, slack_space);
+    }
 
     gc_history_per_heap* current_gc_data_per_heap = get_gc_data_per_heap();
     current_gc_data_per_heap->extra_gen0_committed = heap_segment_committed (ephemeral_heap_segment) - heap_segment_allocated (ephemeral_heap_segment);
 }
 
+#ifdef MULTIPLE_HEAPS
+// Called on heap 0's GC thread while the EE is running. Returns true if there's still 
+// decommit work left for a later step.
+bool gc_heap::decommit_step()
+{
+    // Go faster when memory gets tighter - at very high load the GC would have decommitted
+    // everything inline anyway.
+    size_t step_size = DECOMMIT_SIZE_PER_STEP;
+    if (last_gc_memory_load >= high_memory_load_th)
+    {
+        step_size *= 4;
+    }
+
+    bool work_left_p = false;
+    for (int i = 0; i < n_heaps; i++)
+    {
+        gc_heap* hp = g_heaps[i];
+        if (hp->ephemeral_decommit_target != 0)
+        {
+            hp->decommit_ephemeral_segment_pages_step (step_size);
+            if (hp->ephemeral_decommit_target != 0)
+                work_left_p = true;
+        }
+    }
+    return work_left_p;
+}
+
+// Decommits up to step_size of this heap's ephemeral segment towards ephemeral_decommit_target.
+// Allocating threads only commit more of the ephemeral segment while holding this heap's 
+// more_space_lock_soh, so we hold it too; if it's busy we'll try again on the next step.
+size_t gc_heap::decommit_ephemeral_segment_pages_step (size_t step_size)
+{
+    if (!try_enter_spin_lock (&more_space_lock_soh))
+        return 0;
+
+    size_t decommitted = 0;
+    heap_segment* seg = ephemeral_heap_segment;
+    uint8_t* target = ephemeral_decommit_target;
+
+    // Never go below what's been handed out since the GC, with a bit of room to spare.
+    uint8_t* low = align_on_page (heap_segment_allocated (seg)) + 2*OS_PAGE_SIZE;
+    if ((target < heap_segment_mem (seg)) || (target > heap_segment_reserved (seg)))
+    {
+        target = heap_segment_committed (seg);
+    }
+    target = max (target, low);
+
+    uint8_t* committed = heap_segment_committed (seg);
+    if (target < committed)
+    {
+        uint8_t* new_committed = committed - min (step_size, (size_t)(committed - target));
+        decommitted = decommit_heap_segment_pages_worker (seg, new_committed);
+    }
+
+    if (heap_segment_committed (seg) <= align_on_page (target))
+    {
+        ephemeral_decommit_target = 0;
+    }
+
+    leave_spin_lock (&more_space_lock_soh);
+    return decommitted;
+}
+#endif //MULTIPLE_HEAPS
+
 //This is meant to be called by decide_on_compacting.
 
 size_t gc_heap::generation_fragmentation (generation* gen,
@@ -30825,6 +31929,15 @@ BOOL gc_heap::decide_on_compacting (int condemned_gen_number,
     if (GCConfig::GetForceCompact())
         should_compact = TRUE;
 
+    if ((condemned_gen_number == max_generation) && conserve_mem_frag_target &&
+        ((int)(fragmentation_burden * 100) >= conserve_mem_frag_target))
+    {
+        dprintf (GTC_LOG, ("h%d planned gen2 frag above conserve memory target %d%%", 
+            heap_number, conserve_mem_frag_target));
+        should_compact = TRUE;
+        get_gc_data_per_heap()->set_mechanism (gc_heap_compact, compact_high_frag);
+    }
+
     if ((condemned_gen_number == max_generation) && last_gc_before_oom)
     {
         should_compact = TRUE;
@@ -31008,7 +32121,8 @@ BOOL gc_heap::sufficient_space_end_seg (uint8_t* start, uint8_t* seg_end, size_t
         // so we treat that as segment end, do we have enough space.
         if (heap_hard_limit)
         {
-            size_t left_in_commit = heap_hard_limit - current_total_committed;
+            // With a SOH limit, LOH commits don't take away from what's left for the ephemeral seg.
+            size_t left_in_commit = get_hard_limit_for (oh_soh) - get_committed_for (oh_soh);
             int num_heaps = 1;
 #ifdef MULTIPLE_HEAPS
             num_heaps = n_heaps;
@@ -31186,6 +32300,10 @@ BOOL gc_heap::ephemeral_gen_fit_p (gc_tuning_point tp)
     }
 }
 
+// Every object on the LOH has to cover at least a full mark word (see the 
+// assert in allocate_large_object).
+#define min_poh_alloc_size ((size_t)1024)
+
 CObjectHeader* gc_heap::allocate_large_object (size_t jsize, uint32_t flags, int64_t& alloc_bytes)
 {
     //create a new alloc context because gen3context is shared.
@@ -31215,11 +32333,19 @@ CObjectHeader* gc_heap::allocate_large_object (size_t jsize, uint32_t flags, int
     size_t pad = 0;
 #endif //FEATURE_LOH_COMPACTION
 
+    // Pinned objects can be smaller than the LOH threshold; they are followed by
+    // a free object so what we take from the segment is still big enough.
+    size_t poh_pad = 0;
+    if ((flags & GC_ALLOC_PINNED_OBJECT_HEAP) && (size < min_poh_alloc_size))
+    {
+        poh_pad = max ((min_poh_alloc_size - size), Align (min_obj_size, align_const));
+    }
+
     assert (size >= Align (min_obj_size, align_const));
 #ifdef _MSC_VER
 #pragma inline_depth(0)
 #endif //_MSC_VER
-    if (! allocate_more_space (&acontext, (size + pad), flags, max_generation+1))
+    if (! allocate_more_space (&acontext, (size + poh_pad + pad), flags, max_generation+1))
     {
         return 0;
     }
@@ -31247,8 +32373,14 @@ CObjectHeader* gc_heap::allocate_large_object (size_t jsize, uint32_t flags, int
 
     uint8_t*  result = acontext.alloc_ptr;
 
-    assert ((size_t)(acontext.alloc_limit - acontext.alloc_ptr) == size);
-    alloc_bytes += size;
+    assert ((size_t)(acontext.alloc_limit - acontext.alloc_ptr) == (size + poh_pad));
+    alloc_bytes += size + poh_pad;
+
+    if (poh_pad)
+    {
+        make_unused_array (result + size, poh_pad);
+        size += poh_pad;
+    }
 
     CObjectHeader* obj = (CObjectHeader*)result;
 
@@ -31265,7 +32397,12 @@ CObjectHeader* gc_heap::allocate_large_object (size_t jsize, uint32_t flags, int
 #ifdef BACKGROUND_GC
         //the object has to cover one full mark uint32_t
         assert (size > mark_word_size);
-        if (current_c_gc_state != c_gc_state_free)
+        // With concurrent LOH sweep the sweep only goes up to each segment's background
+        // allocated, which was recorded before any allocation in the planning state, so 
+        // what we allocate now doesn't need the mark bit. Setting it would be wrong on the
+        // segments the sweep has already passed - nothing would clear it before the next BGC.
+        if ((current_c_gc_state != c_gc_state_free) &&
+            !(concurrent_loh_sweep_p && (current_c_gc_state == c_gc_state_planning)))
         {
             dprintf (3, ("Concurrent allocation of a large object %Ix",
                         (size_t)obj));
@@ -31461,8 +32598,12 @@ void gc_heap::background_delay_delete_loh_segments()
 
 uint8_t* gc_heap::background_next_end (heap_segment* seg, BOOL large_objects_p)
 {
+    // With concurrent LOH sweep we only sweep the LOH objects that existed when sweep
+    // started; process_background_segment_end takes care of the ones allocated past
+    // heap_segment_background_allocated.
     return
-        (large_objects_p ? heap_segment_allocated (seg) : heap_segment_background_allocated (seg));
+        ((large_objects_p && !concurrent_loh_sweep_p) ? 
+            heap_segment_allocated (seg) : heap_segment_background_allocated (seg));
 }
 
 void gc_heap::set_mem_verify (uint8_t* start, uint8_t* end, uint8_t b)
@@ -31532,7 +32673,27 @@ void gc_heap::process_background_segment_end (heap_segment* seg,
     dprintf (3, ("Processing end of background segment [%Ix, %Ix[(%Ix[)", 
                 (size_t)heap_segment_mem (seg), background_allocated, allocated));
 
-    if (!loh_p && (allocated != background_allocated))
+    if (loh_p && loh_sweep_concurrent_p && (background_allocated == 0))
+    {
+        // This segment was acquired after sweep started so we didn't sweep it. 
+        // Everything on it is live and got its mark bit set when it was allocated.
+        dprintf (3, ("Clearing mark bits of concurrent LOH allocs [%Ix, %Ix[", 
+                    (size_t)heap_segment_mem (seg), (size_t)allocated));
+        bgc_clear_batch_mark_array_bits (heap_segment_mem (seg), allocated);
+    }
+    else if (loh_p && loh_sweep_concurrent_p && (allocated != background_allocated))
+    {
+        // Objects were allocated at the end of this segment after sweep started, 
+        // so we can't trim it - just make what we swept at the end free.
+        dprintf (3, ("Make a free object before concurrent LOH allocs [%Ix, %Ix[", 
+                    (size_t)last_plug_end, background_allocated));
+        thread_gap (last_plug_end, background_allocated - last_plug_end, gen);
+
+        // We didn't sweep those objects so clear the mark bits they got when they 
+        // were allocated.
+        bgc_clear_batch_mark_array_bits (background_allocated, allocated);
+    }
+    else if (!loh_p && (allocated != background_allocated))
     {
         assert (gen != large_object_generation);
 
@@ -31570,7 +32731,11 @@ void gc_heap::process_background_segment_end (heap_segment* seg,
             dprintf (3, ("Segment allocated is %Ix (beginning of this seg) - %s be deleted",
                         (size_t)allocated, (*delete_p ? "should" : "should not")));
 
-            if (seg != start_seg)
+            // While LOH allocations run concurrently we don't delete the segment they
+            // start looking from, or the last one which new segments are threaded after.
+            if ((seg != start_seg) &&
+                !(loh_p && loh_sweep_concurrent_p && 
+                  ((seg == generation_allocation_segment (gen)) || !heap_segment_next (seg))))
             {
                 *delete_p = TRUE;
             }
@@ -31992,6 +33157,14 @@ void gc_heap::background_sweep()
     {
         if (o >= end)
         {
+            if (loh_sweep_concurrent_p)
+            {
+                // Synchronize with allocations at the end of this segment and with
+                // changes to the segment list.
+                enter_spin_lock (&more_space_lock_loh);
+                add_saved_spinlock_info (true, me_acquire, mt_bgc_loh_sweep);
+            }
+
             if (gen == large_object_generation)
             {
                 next_seg = heap_segment_next (seg);
@@ -32008,9 +33181,10 @@ void gc_heap::background_sweep()
                 if (gen == large_object_generation)
                 {
                     // we can treat all LOH segments as in the bgc domain
-                    // regardless of whether we saw in bgc mark or not
-                    // because we don't allow LOH allocations during bgc
-                    // sweep anyway - the LOH segments can't change.
+                    // regardless of whether we saw in bgc mark or not; with 
+                    // concurrent LOH sweep we only swept up to 
+                    // heap_segment_background_allocated and the LOH allocations
+                    // past that are taken care of in process_background_segment_end.
                     process_background_segment_end (seg, gen, plug_end, 
                                                     start_seg, &delete_p);
                 }
@@ -32039,6 +33213,21 @@ void gc_heap::background_sweep()
 
             seg = next_seg;
 
+            if (loh_sweep_concurrent_p)
+            {
+                if (seg == 0)
+                {
+                    // We keep the msl for the rest of the sweep.
+                    loh_sweep_concurrent_p = false;
+                    concurrent_print_time_delta ("Swe LOH retook msl");
+                }
+                else
+                {
+                    add_saved_spinlock_info (true, me_release, mt_bgc_loh_sweep);
+                    leave_spin_lock (&more_space_lock_loh);
+                }
+            }
+
             dprintf (GTC_LOG, ("seg: %Ix, next_seg: %Ix, prev_seg: %Ix", seg, next_seg, prev_seg));
             
             if (seg == 0)
@@ -32078,7 +33267,7 @@ void gc_heap::background_sweep()
                     align_const = get_alignment_constant (FALSE);
                     o = o + Align(size (o), align_const);
                     plug_end = o;
-                    end = heap_segment_allocated (seg);
+                    end = background_next_end (seg, TRUE);
                     dprintf (2, ("sweeping gen3 objects"));
                     generation_free_obj_space (gen) = 0;
                     generation_allocator (gen)->clear();
@@ -32088,6 +33277,15 @@ void gc_heap::background_sweep()
                                     (size_t)heap_segment_mem (seg),
                                     (size_t)heap_segment_allocated (seg),
                                     (size_t)heap_segment_background_allocated (seg)));
+
+                    if (concurrent_loh_sweep_p)
+                    {
+                        // From here on LOH allocators only need the msl to sync with us
+                        // at segment ends, instead of waiting for the whole LOH sweep.
+                        loh_sweep_concurrent_p = true;
+                        add_saved_spinlock_info (true, me_release, mt_bgc_loh_sweep);
+                        leave_spin_lock (&more_space_lock_loh);
+                    }
                 }
                 else
                     break;
@@ -34169,6 +35367,50 @@ HRESULT GCHeap::Initialize()
         }
     }
 
+    gc_heap::heap_hard_limit_oh[oh_soh] = (size_t)GCConfig::GetGCHeapHardLimitSOH();
+    gc_heap::heap_hard_limit_oh[oh_loh] = (size_t)GCConfig::GetGCHeapHardLimitLOH();
+
+    uint32_t percent_of_mem_oh[total_oh_count];
+    percent_of_mem_oh[oh_soh] = (uint32_t)GCConfig::GetGCHeapHardLimitSOHPercent();
+    percent_of_mem_oh[oh_loh] = (uint32_t)GCConfig::GetGCHeapHardLimitLOHPercent();
+
+    for (int oh = 0; oh < total_oh_count; oh++)
+    {
+        if (!(gc_heap::heap_hard_limit_oh[oh]) && 
+            (percent_of_mem_oh[oh] > 0) && (percent_of_mem_oh[oh] < 100))
+        {
+            gc_heap::heap_hard_limit_oh[oh] = (size_t)(gc_heap::total_physical_mem * (uint64_t)percent_of_mem_oh[oh] / (uint64_t)100);
+        }
+    }
+
+    if (gc_heap::heap_hard_limit_oh[oh_soh] || gc_heap::heap_hard_limit_oh[oh_loh])
+    {
+        // If only one of them is specified the other one gets what's left of the
+        // total limit (which may come from the container). Without a total limit
+        // we can't reserve for the other one so we don't use per object heap limits.
+        for (int oh = 0; oh < total_oh_count; oh++)
+        {
+            if (!(gc_heap::heap_hard_limit_oh[oh]))
+            {
+                size_t other_limit = gc_heap::heap_hard_limit_oh[total_oh_count - 1 - oh];
+                if (gc_heap::heap_hard_limit > other_limit)
+                {
+                    gc_heap::heap_hard_limit_oh[oh] = gc_heap::heap_hard_limit - other_limit;
+                }
+            }
+        }
+
+        if (gc_heap::heap_hard_limit_oh[oh_soh] && gc_heap::heap_hard_limit_oh[oh_loh])
+        {
+            gc_heap::heap_hard_limit = gc_heap::heap_hard_limit_oh[oh_soh] + gc_heap::heap_hard_limit_oh[oh_loh];
+        }
+        else
+        {
+            gc_heap::heap_hard_limit_oh[oh_soh] = 0;
+            gc_heap::heap_hard_limit_oh[oh_loh] = 0;
+        }
+    }
+
     //printf ("heap_hard_limit is %Id, total physical mem: %Id, %s restricted\n", 
     //    gc_heap::heap_hard_limit, gc_heap::total_physical_mem, (is_restricted ? "is" : "is not"));
 #endif //BIT64
@@ -34234,9 +35476,23 @@ HRESULT GCHeap::Initialize()
     size_t seg_size = 0;
     size_t large_seg_size = 0;
 
-    if (gc_heap::heap_hard_limit)
+    if (gc_heap::heap_hard_limit_oh[oh_soh])
     {
-        seg_size = gc_heap::get_segment_size_hard_limit (&nhp, (nhp_from_config == 0));
+        // Each kind of segment is reserved by its own limit. The number of heaps 
+        // can only go down so if the LOH limit lowered it redo the SOH seg size.
+        uint32_t nhp_soh = nhp;
+        seg_size = gc_heap::get_segment_size_hard_limit (gc_heap::heap_hard_limit_oh[oh_soh], &nhp, (nhp_from_config == 0));
+        large_seg_size = gc_heap::get_segment_size_hard_limit (gc_heap::heap_hard_limit_oh[oh_loh], &nhp, (nhp_from_config == 0));
+        if (nhp != nhp_soh)
+        {
+            seg_size = gc_heap::get_segment_size_hard_limit (gc_heap::heap_hard_limit_oh[oh_soh], &nhp, false);
+        }
+        gc_heap::soh_segment_size = seg_size;
+        gc_heap::use_large_pages_p = GCConfig::GetGCLargePages();
+    }
+    else if (gc_heap::heap_hard_limit)
+    {
+        seg_size = gc_heap::get_segment_size_hard_limit (gc_heap::heap_hard_limit, &nhp, (nhp_from_config == 0));
         gc_heap::soh_segment_size = seg_size;
         gc_heap::use_large_pages_p = GCConfig::GetGCLargePages();
         large_seg_size = gc_heap::use_large_pages_p ? seg_size : seg_size * 2;
@@ -34255,7 +35511,27 @@ HRESULT GCHeap::Initialize()
 
     gc_heap::min_loh_segment_size = large_seg_size;
     gc_heap::min_segment_size = min (seg_size, large_seg_size);
+
+    gc_heap::bookkeeping_large_pages_p = GCConfig::GetGCLargePagesBookkeeping();
+
 #ifdef SEG_MAPPING_TABLE
+    // We never acquire new segments with a hard limit so regions don't apply there.
+    // Regions need the seg mapping table since they are usually smaller than the
+    // normal min segment size.
+    size_t region_size = static_cast<size_t>(GCConfig::GetRegionSize());
+    if (region_size && !gc_heap::heap_hard_limit)
+    {
+        // Same minimum as we enforce for segments.
+        region_size = max (round_up_power2 (region_size), (size_t)(1024*1024*4));
+        if (region_size < seg_size)
+        {
+            gc_heap::soh_region_size = region_size;
+            gc_heap::min_segment_size = min (gc_heap::min_segment_size, region_size);
+        }
+    }
+
+    dprintf (1, ("soh region size: %Id mb\n", (gc_heap::soh_region_size / (size_t)1024 / 1024)));
+
     gc_heap::min_segment_size_shr = index_of_highest_set_bit (gc_heap::min_segment_size);
 #endif //SEG_MAPPING_TABLE
 
@@ -34957,7 +36233,7 @@ GCHeap::AllocAlign8Common(void* _hp, alloc_context* acontext, size_t size, uint3
 #endif //COUNT_CYCLES
 #endif //TRACE_GC
 
-    if (size < loh_size_threshold)
+    if ((size < loh_size_threshold) && !(flags & GC_ALLOC_PINNED_OBJECT_HEAP))
     {
 #ifdef TRACE_GC
         AllocSmallCount++;
@@ -35021,7 +36297,7 @@ GCHeap::AllocAlign8Common(void* _hp, alloc_context* acontext, size_t size, uint3
         // The LOH always guarantees at least 8-byte alignment, regardless of platform. Moreover it doesn't
         // support mis-aligned object headers so we can't support biased headers as above. Luckily for us
         // we've managed to arrange things so the only case where we see a bias is for boxed value types and
-        // these can never get large enough to be allocated on the LOH.
+        // these can never get large enough to be allocated on the LOH (nor are they ever allocated pinned).
         ASSERT(65536 < loh_size_threshold);
         ASSERT((flags & GC_ALLOC_ALIGN8_BIAS) == 0);
 
@@ -35146,7 +36422,7 @@ GCHeap::Alloc(gc_alloc_context* context, size_t size, uint32_t flags REQD_ALIGN_
 #endif //_PREFAST_
 #endif //MULTIPLE_HEAPS
 
-    if (size < loh_size_threshold)
+    if ((size < loh_size_threshold) && !(flags & GC_ALLOC_PINNED_OBJECT_HEAP))
     {
 
 #ifdef TRACE_GC
@@ -35184,11 +36460,13 @@ void
 GCHeap::FixAllocContext (gc_alloc_context* context, void* arg, void *heap)
 {
     alloc_context* acontext = static_cast<alloc_context*>(context);
-#ifdef MULTIPLE_HEAPS
 
+    // This is also what get_alloc_quantum counts refills since the last GC with.
     if (arg != 0)
         acontext->alloc_count = 0;
 
+#ifdef MULTIPLE_HEAPS
+
     uint8_t * alloc_ptr = acontext->alloc_ptr;
 
     if (!alloc_ptr)
@@ -35657,6 +36935,47 @@ bool gc_heap::is_pm_ratio_exceeded()
     return maxgen_highfrag_p;
 }
 
+// Called at the end of each blocking GC when GCPauseTarget is set. Shrinks the ephemeral budgets
+// after a GC that went over the target and grows them back slowly after GCs that stay well under it.
+void gc_heap::update_pause_target_budget()
+{
+#ifdef MULTIPLE_HEAPS
+    gc_heap* hp = g_heaps[0];
+#else
+    gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+
+    int gen = settings.condemned_generation;
+    size_t pause_ms = dd_gc_elapsed_time (hp->dynamic_data_of (gen));
+
+    if (pause_ms > pause_target_ms)
+    {
+        pause_target_miss_count++;
+
+        // Full GCs aren't sized by the ephemeral budgets, don't penalize them for it.
+        if (gen < max_generation)
+        {
+            pause_target_budget_pct = max (10, pause_target_budget_pct * 3 / 4);
+        }
+
+        dprintf (1, ("GC#%Id gen%d pause %Idms over target %Idms (%Id misses), ephemeral budget now %d%%",
+            (size_t)settings.gc_index, gen, pause_ms, pause_target_ms, pause_target_miss_count,
+            pause_target_budget_pct));
+
+        FIRE_EVENT(GCPauseTargetMissed,
+                   (uint32_t)settings.gc_index,
+                   (uint32_t)gen,
+                   (uint32_t)pause_ms,
+                   (uint32_t)pause_target_ms,
+                   (uint32_t)pause_target_miss_count,
+                   (uint32_t)pause_target_budget_pct);
+    }
+    else if ((gen < max_generation) && (pause_ms < (pause_target_ms / 2)))
+    {
+        pause_target_budget_pct = min (100, pause_target_budget_pct + 5);
+    }
+}
+
 void gc_heap::do_post_gc()
 {
     if (!settings.concurrent)
@@ -35700,6 +37019,11 @@ void gc_heap::do_post_gc()
     last_gc_heap_size = get_total_heap_size();
     last_gc_fragmentation = get_total_fragmentation();
 
+    if ((pause_target_ms != 0) && !settings.concurrent)
+    {
+        update_pause_target_budget();
+    }
+
 #ifdef TRACE_GC
     if (heap_hard_limit)
     {
@@ -21,6 +21,8 @@ IGCHandleManager* g_theGCHandleManager;
 IGCToCLR* g_theGCToCLR;
 #endif // BUILD_AS_STANDALONE
 
+VersionInfo g_runtimeSupportedVersion;
+
 #ifdef GC_CONFIG_DRIVEN
 size_t gc_global_mechanisms[MAX_GLOBAL_GC_MECHANISMS_COUNT];
 #endif //GC_CONFIG_DRIVEN
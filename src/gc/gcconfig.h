@@ -75,6 +75,18 @@ public:
   BOOL_CONFIG(GCNumaAware,   "GCNumaAware", true, "Enables numa allocations in the GC")        \
   BOOL_CONFIG(GCCpuGroup,    "GCCpuGroup", false, "Enables CPU groups in the GC")              \
   BOOL_CONFIG(GCLargePages,  "GCLargePages", false, "Enables using Large Pages in the GC")     \
+  INT_CONFIG(GCAllocQuantumMaxShift, "GCAllocQuantumMaxShift", 4,                             \
+      "Max times the alloc quantum doubles for threads that allocate a lot, 0 disables")     \
+  BOOL_CONFIG(GCConcurrentLOHSweep, "GCConcurrentLOHSweep", true,                             \
+      "Lets LOH allocations proceed while background GC sweeps the LOH")                       \
+  BOOL_CONFIG(GCLargePagesBookkeeping, "GCLargePagesBookkeeping", false,                       \
+      "Back the card table, brick table, card bundles and mark array with large pages")        \
+  INT_CONFIG(GCPauseTarget, "GCPauseTarget", 0,                                               \
+      "Specifies a target maximum blocking GC pause in milliseconds, 0 means no target")       \
+  BOOL_CONFIG(GCGradualDecommit, "GCGradualDecommit", true,                                    \
+      "Decommit the ephemeral segments' free space in steps after the GC instead of during it (Server GC)") \
+  INT_CONFIG(GCMemoryPressureStall, "GCMemoryPressureStall", 0,                                \
+      "Memory pressure stall percentage (PSI some avg10) treated as very high memory load, 0 disables") \
   INT_CONFIG(HeapVerifyLevel, "HeapVerify", HEAPVERIFY_NONE,                                   \
       "When set verifies the integrity of the managed heap on entry and exit of each GC")      \
   INT_CONFIG(LOHCompactionMode, "GCLOHCompact", 0, "Specifies the LOH compaction mode")        \
@@ -83,8 +95,14 @@ public:
   INT_CONFIG(BGCSpinCount,  "BGCSpinCount", 140, "Specifies the bgc spin count")               \
   INT_CONFIG(BGCSpin,       "BGCSpin",      2,   "Specifies the bgc spin time")                \
   INT_CONFIG(HeapCount,     "GCHeapCount",  0,   "Specifies the number of server GC heaps")    \
+  BOOL_CONFIG(DynamicHeapCount, "GCDynamicHeapCount", false,                                   \
+      "When set, the number of server GC heaps allocations are balanced to is adjusted "       \
+      "between GCs based on the measured GC pause cost")                                       \
   INT_CONFIG(Gen0Size,      "GCgen0size",   0, "Specifies the smallest gen0 size")             \
   INT_CONFIG(SegmentSize,   "GCSegmentSize", 0, "Specifies the managed heap segment size")     \
+  INT_CONFIG(RegionSize,    "GCRegionSize", 0,                                                 \
+      "Specifies the granularity of new SOH segments acquired when the ephemeral generations " \
+      "need to expand. 0 means always acquire a full sized segment")                           \
   INT_CONFIG(LatencyMode,   "GCLatencyMode", -1,                                               \
       "Specifies the GC latency mode - batch, interactive or low latency (note that the same " \
       "thing can be specified via API which is the supported way")                             \
@@ -110,6 +128,16 @@ public:
       "Specifies a hard limit for the GC heap")                                                \
   INT_CONFIG(GCHeapHardLimitPercent, "GCHeapHardLimitPercent", 0,                              \
       "Specifies the GC heap usage as a percentage of the total memory")                       \
+  INT_CONFIG(GCHeapHardLimitSOH, "GCHeapHardLimitSOH", 0,                                      \
+      "Specifies a hard limit for the GC heap SOH")                                            \
+  INT_CONFIG(GCHeapHardLimitLOH, "GCHeapHardLimitLOH", 0,                                      \
+      "Specifies a hard limit for the GC heap LOH")                                            \
+  INT_CONFIG(GCHeapHardLimitSOHPercent, "GCHeapHardLimitSOHPercent", 0,                        \
+      "Specifies the GC heap SOH usage as a percentage of the total memory")                   \
+  INT_CONFIG(GCHeapHardLimitLOHPercent, "GCHeapHardLimitLOHPercent", 0,                        \
+      "Specifies the GC heap LOH usage as a percentage of the total memory")                   \
+  INT_CONFIG(GCConserveMem, "GCConserveMemory", 0,                                             \
+      "Specifies the percentage of gen2 that can be fragmented before GC compacts it")        \
   STRING_CONFIG(LogFile,    "GCLogFile",    "Specifies the name of the GC log file")           \
   STRING_CONFIG(ConfigLogFile, "GCConfigLogFile",                                              \
       "Specifies the name of the GC config log file")                                          \
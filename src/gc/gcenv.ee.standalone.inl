@@ -12,6 +12,16 @@
 // will be fowarded to this interface instance.
 extern IGCToCLR* g_theGCToCLR;
 
+// The version of the GC/EE interface the EE was built against, as passed to
+// GC_VersionInfo. Zeroed if the EE predates minor version 3.
+extern VersionInfo g_runtimeSupportedVersion;
+
+inline bool IsRuntimeInterfaceMinorVersionAtLeast(uint32_t minorVersion)
+{
+    return (g_runtimeSupportedVersion.MajorVersion == GC_INTERFACE_MAJOR_VERSION) &&
+           (g_runtimeSupportedVersion.MinorVersion >= minorVersion);
+}
+
 // When we are building the GC in a standalone environment, we
 // will be dispatching virtually against g_theGCToCLR to call
 // into the EE. This class provides an identical API to the existing
@@ -295,4 +305,24 @@ inline void GCToEEInterface::UpdateGCEventStatus(int publicLevel, int publicKeyw
 #endif // __linux__
 }
 
+inline uint32_t GCToEEInterface::GetCapabilityVersion(GCToEECapability capability)
+{
+    assert(g_theGCToCLR != nullptr);
+
+    // Older EEs don't have this method in their vtable.
+    if (!IsRuntimeInterfaceMinorVersionAtLeast(3))
+    {
+        return 0;
+    }
+
+    return g_theGCToCLR->GetCapabilityVersion(capability);
+}
+
+inline bool GCToEEInterface::GetNumaTopology(uint16_t* highestNode)
+{
+    assert(g_theGCToCLR != nullptr);
+    assert(GetCapabilityVersion(GCToEECapability_NumaTopology) != 0);
+    return g_theGCToCLR->GetNumaTopology(highestNode);
+}
+
 #endif // __GCTOENV_EE_STANDALONE_INL__
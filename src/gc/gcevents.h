@@ -47,5 +47,16 @@ KNOWN_EVENT(PrvSetGCHandle, GCEventProvider_Private, GCEventLevel_Information, G
 KNOWN_EVENT(PrvDestroyGCHandle, GCEventProvider_Private, GCEventLevel_Information, GCEventKeyword_GCHandlePrivate)
 KNOWN_EVENT(PinPlugAtGCTime, GCEventProvider_Private, GCEventLevel_Verbose, GCEventKeyword_GCPrivate)
 
+// Whether the initial card table got large pages, and its size.
+DYNAMIC_EVENT(GCBookkeepingLargePages, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint64_t)
+
+// GC index, NUMA node, bytes allocated on the node's heaps, allocation contexts moved 
+// to the node's heaps from threads on the same node, from threads on other nodes.
+DYNAMIC_EVENT(GCNumaNodeAllocStats, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t, uint64_t, uint32_t, uint32_t)
+
+// GC index, condemned generation, pause in ms, GCPauseTarget in ms, pauses over the target so far,
+// percentage of the computed gen0/gen1 budgets used for the next GCs.
+DYNAMIC_EVENT(GCPauseTargetMissed, GCEventLevel_Information, GCEventKeyword_GC, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t)
+
 #undef KNOWN_EVENT
 #undef DYNAMIC_EVENT
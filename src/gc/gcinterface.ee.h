@@ -21,6 +21,16 @@ enum EtwGCRootKind
     kEtwGCRootKindOther =               3,
 };
 
+// Optional capabilities an EE may offer to the GC, queried with
+// IGCToCLR::GetCapabilityVersion. Each capability guards the IGCToCLR methods
+// listed next to it; a GC must not call them unless the EE reports a version it
+// understands. New capabilities are only ever appended.
+enum GCToEECapability
+{
+    // GetNumaTopology
+    GCToEECapability_NumaTopology =     1,
+};
+
 // This interface provides functions that the GC can use to fire events.
 // Events fired on this interface are split into two categories: "known"
 // events and "dynamic" events. Known events are events that are baked-in
@@ -418,6 +428,17 @@ public:
 
     virtual
     void UpdateGCEventStatus(int publicLevel, int publicKeywords, int privateLEvel, int privateKeywords) = 0;
+
+    // Returns the version of the given optional capability that the EE implements,
+    // or 0 if it does not implement it. Only present on EEs with interface minor
+    // version 3 or later.
+    virtual
+    uint32_t GetCapabilityVersion(GCToEECapability capability) = 0;
+
+    // GCToEECapability_NumaTopology: returns true and the highest NUMA node number
+    // if the EE wants the GC to be NUMA aware, false otherwise.
+    virtual
+    bool GetNumaTopology(uint16_t* highestNode) = 0;
 };
 
 #endif // _GCINTERFACE_EE_H_
@@ -12,7 +12,11 @@
 // The minor version of the GC/EE interface. Non-breaking changes are required
 // to bump the minor version number. GCs and EEs with minor version number
 // mismatches can still interopate correctly, with some care.
-#define GC_INTERFACE_MINOR_VERSION 1
+//
+// Minor version 3 - the EE passes its own version to GC_VersionInfo and IGCToCLR
+// gained GetCapabilityVersion, behind which optional EE callbacks can be added
+// without a major version bump.
+#define GC_INTERFACE_MINOR_VERSION 3
 
 struct ScanContext;
 struct gc_alloc_context;
@@ -906,6 +910,10 @@ enum GC_ALLOC_FLAGS
     GC_ALLOC_ALIGN8_BIAS        = 4,
     GC_ALLOC_ALIGN8             = 8,
     GC_ALLOC_ZEROING_OPTIONAL   = 16,
+    // The object will stay pinned for its whole lifetime. It is allocated on
+    // the pinned object heap (a kind of LOH segment that is never compacted)
+    // regardless of its size.
+    GC_ALLOC_PINNED_OBJECT_HEAP = 32,
 };
 
 inline GC_ALLOC_FLAGS operator|(GC_ALLOC_FLAGS a, GC_ALLOC_FLAGS b)
@@ -964,6 +972,11 @@ struct ScanContext
 
 // These types are used as part of the loader protocol between the EE
 // and the GC.
+//
+// On entry to GC_VersionInfo the structure holds the version of the interface
+// the EE was built against, so that the GC knows which IGCToCLR methods it may
+// call. EEs that predate minor version 3 pass a zeroed structure. On exit it
+// holds the version of the GC.
 struct VersionInfo {
     uint32_t MajorVersion;
     uint32_t MinorVersion;
@@ -972,7 +985,7 @@ struct VersionInfo {
 };
 
 typedef void (*GC_VersionInfoFunction)(
-    /* Out */ VersionInfo*
+    /* InOut */ VersionInfo*
 );
 
 typedef HRESULT (*GC_InitializeFunction)(
@@ -38,10 +38,15 @@ namespace SVR
 // This symbol populates GcDacVars with handle table dacvars.
 extern void PopulateHandleTableDacVars(GcDacVars* dacVars);
 
+extern VersionInfo g_runtimeSupportedVersion;
+
 GC_EXPORT
 void
-GC_VersionInfo(/* Out */ VersionInfo* info)
+GC_VersionInfo(/* InOut */ VersionInfo* info)
 {
+    // Remember which interface the EE speaks before overwriting it with ours.
+    g_runtimeSupportedVersion = *info;
+
     info->MajorVersion = GC_INTERFACE_MAJOR_VERSION;
     info->MinorVersion = GC_INTERFACE_MINOR_VERSION;
     info->BuildVersion = 0;
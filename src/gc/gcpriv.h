@@ -85,8 +85,15 @@ inline void FATAL_GC_ERROR()
 #define MH_SC_MARK //scalable marking
 //#define SNOOP_STATS //diagnostic
 #define PARALLEL_MARK_LIST_SORT //do the sorting and merging of the multiple mark lists in server gc in parallel
+#define CARD_MARKING_STEALING //let server gc threads mark through cards on other heaps' gen2 segments
 #endif //SERVER_GC
 
+#ifdef CARD_MARKING_STEALING
+// The gen2 segments (other than the ephemeral one) are split into chunks of this
+// many bytes to be marked through cards by whichever server gc thread claims them.
+#define CARD_MARKING_STEALING_GRANULARITY (2*1024*1024)
+#endif //CARD_MARKING_STEALING
+
 //This is used to mark some type volatile only when the scalable marking is used. 
 #if defined (SERVER_GC) && defined (MH_SC_MARK)
 #define SERVER_SC_MARK_VOLATILE(x) VOLATILE(x)
@@ -641,6 +648,7 @@ typedef DPTR(class CFinalize)                  PTR_CFinalize;
 //and doubling each time. The last bucket (index == num_buckets) is for largest sizes with no limit
 
 #define MAX_BUCKET_COUNT (13)//Max number of buckets for the small generations. 
+#define MAX_BEST_FIT_CANDIDATES (8)//Max number of items we look at for a best fit when allocating in gen2.
 class alloc_list 
 {
     uint8_t* head;
@@ -668,6 +676,8 @@ class allocator
 {
     size_t num_buckets;
     size_t frst_bucket_size;
+    // log2 of frst_bucket_size, so we can find the bucket for a size in O(1).
+    unsigned int frst_bucket_bits;
     alloc_list first_bucket;
     alloc_list* buckets;
     alloc_list& alloc_list_of (unsigned int bn);
@@ -679,9 +689,15 @@ public:
     {
         num_buckets = 1;
         frst_bucket_size = SIZE_T_MAX;
+        frst_bucket_bits = 0;
     }
     unsigned int number_of_buckets() {return (unsigned int)num_buckets;}
 
+    // The bucket an item of this size is threaded onto - bucket 0 holds items
+    // smaller than the first bucket size and each bucket after that covers twice
+    // the sizes of the previous one, with the last one taking everything else.
+    unsigned int first_suitable_bucket (size_t size);
+
     size_t first_bucket_size() {return frst_bucket_size;}
     uint8_t*& alloc_list_head_of (unsigned int bn)
     {
@@ -1072,6 +1088,16 @@ enum interesting_data_point
     max_idp_count
 };
 
+// The object heap a commit is charged to for GCHeapHardLimitSOH/LOH. 
+// Commits for the GC's own bookkeeping aren't charged to either.
+enum gc_oh_num
+{
+    oh_soh = 0,
+    oh_loh = 1,
+    total_oh_count = 2,
+    oh_none = -1
+};
+
 //class definition of the internal class
 class gc_heap
 {
@@ -1183,6 +1209,7 @@ public:
     static
     heap_segment* make_heap_segment (uint8_t* new_pages,
                                      size_t size, 
+                                     gc_oh_num oh,
                                      int h_number);
     static
     l_heap* make_large_heap (uint8_t* new_pages, size_t size, BOOL managed);
@@ -1212,7 +1239,15 @@ public:
     // If the hard limit is specified, take that into consideration
     // and this means it may modify the # of heaps.
     PER_HEAP_ISOLATED
-    size_t get_segment_size_hard_limit (uint32_t* num_heaps, bool should_adjust_num_heaps);
+    size_t get_segment_size_hard_limit (size_t limit, uint32_t* num_heaps, bool should_adjust_num_heaps);
+
+    // The limit and the committed bytes that the budget for oh should be checked 
+    // against - the per object heap ones if they are specified, else the total.
+    PER_HEAP_ISOLATED
+    size_t get_hard_limit_for (gc_oh_num oh);
+
+    PER_HEAP_ISOLATED
+    size_t get_committed_for (gc_oh_num oh);
 
     PER_HEAP_ISOLATED
     bool should_retry_other_heap (size_t size);
@@ -1232,6 +1267,10 @@ public:
     // Unlike balance_heaps_loh, this may return nullptr if we failed to change heaps.
     static
     gc_heap* balance_heaps_loh_hard_limit_retry (alloc_context* acontext, size_t size);
+    PER_HEAP_ISOLATED
+    void check_dynamic_heap_count ();
+    PER_HEAP_ISOLATED
+    void fire_numa_node_alloc_events();
     static
     void gc_thread_stub (void* arg);
 #endif //MULTIPLE_HEAPS
@@ -1255,6 +1294,9 @@ public:
     PER_HEAP_ISOLATED
     void do_post_gc();
 
+    PER_HEAP_ISOLATED
+    void update_pause_target_budget();
+
     PER_HEAP
     BOOL expand_soh_with_minimal_gc();
 
@@ -1450,8 +1492,10 @@ protected:
     void fire_etw_pin_object_event (uint8_t* object, uint8_t** ppObject);
 
     PER_HEAP
-    size_t limit_from_size (size_t size, uint32_t flags, size_t room, int gen_number,
-                            int align_const);
+    size_t limit_from_size (size_t size, uint32_t flags, alloc_context* acontext, 
+                            size_t room, int gen_number, int align_const);
+    PER_HEAP
+    size_t get_alloc_quantum (alloc_context* acontext);
     PER_HEAP
     allocation_state try_allocate_more_space (alloc_context* acontext, size_t jsize, uint32_t flags, 
                                               int alloc_generation_number);
@@ -1549,6 +1593,7 @@ protected:
     PER_HEAP
     BOOL loh_get_new_seg (generation* gen,
                           size_t size,
+                          uint32_t flags,
                           int align_const,
                           BOOL* commit_failed_p,
                           oom_reason* oom_r);
@@ -1665,6 +1710,8 @@ protected:
     PER_HEAP
     heap_segment* soh_get_segment_to_expand();
     PER_HEAP
+    size_t get_soh_expansion_size();
+    PER_HEAP
     heap_segment* get_segment (size_t size, BOOL loh_p);
     PER_HEAP_ISOLATED
     void seg_mapping_table_add_segment (heap_segment* seg, gc_heap* hp);
@@ -1685,13 +1732,17 @@ protected:
     PER_HEAP
     void decommit_heap_segment_pages (heap_segment* seg, size_t extra_space);
     PER_HEAP
+    size_t decommit_heap_segment_pages_worker (heap_segment* seg, uint8_t* new_committed);
+    PER_HEAP
     void decommit_heap_segment (heap_segment* seg);
     PER_HEAP_ISOLATED
     bool virtual_alloc_commit_for_heap (void* addr, size_t size, int h_number);
     PER_HEAP_ISOLATED
-    bool virtual_commit (void* address, size_t size, int h_number=-1, bool* hard_limit_exceeded_p=NULL);
+    bool virtual_commit (void* address, size_t size, gc_oh_num oh, int h_number=-1, bool* hard_limit_exceeded_p=NULL);
     PER_HEAP_ISOLATED
-    bool virtual_decommit (void* address, size_t size, int h_number=-1);
+    bool virtual_decommit (void* address, size_t size, gc_oh_num oh, int h_number=-1);
+    PER_HEAP_ISOLATED
+    bool on_bookkeeping_large_pages_p (uint8_t* address, size_t size);
     PER_HEAP
     void clear_gen0_bricks();
 #ifdef BACKGROUND_GC
@@ -2033,6 +2084,12 @@ protected:
     void background_mark_simple (uint8_t* o THREAD_NUMBER_DCL);
     PER_HEAP
     void background_mark_simple1 (uint8_t* o THREAD_NUMBER_DCL);
+#ifdef MULTIPLE_HEAPS
+    PER_HEAP
+    void bgc_share_mark_stack ();
+    PER_HEAP
+    void bgc_mark_steal ();
+#endif //MULTIPLE_HEAPS
     PER_HEAP_ISOLATED
     void background_promote (Object**, ScanContext* , uint32_t);
     PER_HEAP
@@ -2439,6 +2496,22 @@ protected:
     PER_HEAP
     void mark_through_cards_for_segments (card_fn fn, BOOL relocating);
 
+#ifdef CARD_MARKING_STEALING
+    PER_HEAP
+    BOOL find_next_card_marking_chunk (heap_segment*& seg, uint8_t*& beg, uint8_t*& end, 
+                                       uint8_t*& first_object, int& heap_offset, 
+                                       BOOL& eph_seg_done_p);
+
+    // The next chunk of this heap's gen2 segments to mark through cards for
+    // during an ephemeral GC, claimed by any heap's gc thread.
+    PER_HEAP
+    VOLATILE(int32_t) card_marking_chunk_index;
+
+    // Whether chunks are claimed across heaps during this GC's card marking.
+    PER_HEAP_ISOLATED
+    BOOL card_marking_stealing_p;
+#endif //CARD_MARKING_STEALING
+
     PER_HEAP
     void repair_allocation_in_expanded_heap (generation* gen);
     PER_HEAP
@@ -2549,6 +2622,14 @@ protected:
     PER_HEAP
     void decommit_ephemeral_segment_pages();
 
+#ifdef MULTIPLE_HEAPS
+    PER_HEAP
+    size_t decommit_ephemeral_segment_pages_step (size_t step_size);
+
+    PER_HEAP_ISOLATED
+    bool decommit_step();
+#endif //MULTIPLE_HEAPS
+
 #ifdef BIT64
     PER_HEAP_ISOLATED
     size_t trim_youngest_desired (uint32_t memory_load,
@@ -2568,6 +2649,10 @@ protected:
     PER_HEAP_ISOLATED
     size_t get_total_gen_estimated_reclaim (int gen_number);
     PER_HEAP_ISOLATED
+    size_t get_total_gen_size (int gen_number);
+    PER_HEAP_ISOLATED
+    BOOL conserve_mem_frag_exceeded_p ();
+    PER_HEAP_ISOLATED
     void get_memory_info (uint32_t* memory_load, 
                           uint64_t* available_physical=NULL,
                           uint64_t* available_page_file=NULL);
@@ -2663,6 +2748,11 @@ protected:
 #endif
 #endif //MULTIPLE_HEAPS
 
+#ifdef MARK_LIST
+    PER_HEAP_ISOLATED
+    void grow_mark_list();
+#endif //MARK_LIST
+
     /*------------ End of Multiple non isolated heaps ---------*/
 
 #ifndef SEG_MAPPING_TABLE
@@ -3087,6 +3177,23 @@ public:
     PER_HEAP_ISOLATED
     uint32_t v_high_memory_load_th;
 
+    // From GCMemoryPressureStall - when the OS reports threads were stalled on memory for at
+    // least this percentage of recent time we behave as if memory load is very high. 0 means
+    // we don't look at it.
+    PER_HEAP_ISOLATED
+    uint32_t memory_pressure_stall_th;
+
+#ifdef MULTIPLE_HEAPS
+    // From GCGradualDecommit - if true we leave the ephemeral decommit to heap 0's GC 
+    // thread after the EE restarts.
+    PER_HEAP_ISOLATED
+    bool gradual_decommit_p;
+
+    // Set when some heap still has an ephemeral_decommit_target to get to.
+    PER_HEAP_ISOLATED
+    bool gradual_decommit_in_progress_p;
+#endif //MULTIPLE_HEAPS
+
     PER_HEAP_ISOLATED
     uint64_t mem_one_percent;
 
@@ -3152,9 +3259,40 @@ public:
     // TODO: some of the logic here applies to the general case as well
     // such as LOH automatic compaction. However it will require more 
     //testing to change the general case.
+    //
+    // SOH and LOH can also be given their own limits via GCHeapHardLimitSOH/LOH
+    // (or GCHeapHardLimitSOHPercent/LOHPercent). Then each kind of segment is 
+    // reserved by its own limit, commits are checked against the limit of the 
+    // heap they are for and heap_hard_limit is the sum of the two. This way 
+    // LOH allocations can't use up the space ephemeral GCs need.
     PER_HEAP_ISOLATED
     size_t heap_hard_limit;
 
+    PER_HEAP_ISOLATED
+    size_t heap_hard_limit_oh[total_oh_count];
+
+    PER_HEAP_ISOLATED
+    size_t committed_by_oh[total_oh_count];
+
+    // From GCConserveMemory - if gen2 fragmentation goes above this percentage 
+    // of gen2 size we do a compacting full GC. 0 means we don't.
+    PER_HEAP_ISOLATED
+    int conserve_mem_frag_target;
+
+    // From GCPauseTarget - the longest blocking GC pause (in ms) we try to stay under. 0 means
+    // no target.
+    PER_HEAP_ISOLATED
+    size_t pause_target_ms;
+
+    // How many blocking GCs took longer than pause_target_ms.
+    PER_HEAP_ISOLATED
+    size_t pause_target_miss_count;
+
+    // Percentage of the computed gen0/gen1 budgets we actually use, lowered when GCs go over
+    // pause_target_ms and raised back when they are comfortably under it.
+    PER_HEAP_ISOLATED
+    int pause_target_budget_pct;
+
     PER_HEAP_ISOLATED
     CLRCriticalSection check_commit_cs;
 
@@ -3173,6 +3311,21 @@ public:
     PER_HEAP_ISOLATED
     bool use_large_pages_p;
 
+    // This is if new card tables (and everything allocated with them, including
+    // the mark array) should be backed by large pages. It's cleared the first time
+    // a table can't get them; that table and the later ones use normal pages.
+    PER_HEAP_ISOLATED
+    bool bookkeeping_large_pages_p;
+
+    // If any card table got large pages.
+    PER_HEAP_ISOLATED
+    bool bookkeeping_large_pages_used_p;
+
+    // The card table make_card_table or grow_brick_card_tables is setting up,
+    // before it's linked in as the current one.
+    PER_HEAP_ISOLATED
+    uint32_t* bookkeeping_new_card_table;
+
     PER_HEAP_ISOLATED
     size_t last_gc_index;
 
@@ -3189,6 +3342,12 @@ public:
     PER_HEAP_ISOLATED
     size_t soh_segment_size;
 
+    // When non zero, new ephemeral segments are sized in multiples of this
+    // (instead of always being soh_segment_size) so we only reserve what the
+    // ephemeral generations actually need and can give it back cheaply.
+    PER_HEAP_ISOLATED
+    size_t soh_region_size;
+
     PER_HEAP_ISOLATED
     size_t min_loh_segment_size;
 
@@ -3216,6 +3375,21 @@ protected:
     int heap_number;
     PER_HEAP
     VOLATILE(int) alloc_context_count;
+
+    // How many allocation contexts balance_heaps moved to this heap from a thread 
+    // on the same NUMA node vs a different one, and what this heap had allocated
+    // when we last fired GCNumaNodeAllocStats.
+    PER_HEAP
+    VOLATILE(int32_t) alloc_context_local_switches;
+    PER_HEAP
+    VOLATILE(int32_t) alloc_context_remote_switches;
+    PER_HEAP
+    uint64_t last_numa_event_alloc_bytes;
+
+    // Where heap 0's GC thread should decommit this heap's ephemeral segment down to after
+    // the GC, 0 if there's nothing left to decommit.
+    PER_HEAP
+    uint8_t* ephemeral_decommit_target;
 #else //MULTIPLE_HEAPS
 #define vm_heap ((GCHeap*) g_theGCHeap)
 #define heap_number (0)
@@ -3354,6 +3528,16 @@ protected:
     PER_HEAP
     VOLATILE(bgc_state) current_bgc_state;
 
+    // If we let LOH allocations run concurrently with background sweep.
+    PER_HEAP_ISOLATED
+    bool concurrent_loh_sweep_p;
+
+    // Set while this heap's LOH is being swept without holding more_space_lock_loh.
+    // Allocators can only allocate at segment ends (past heap_segment_background_allocated)
+    // or on new segments since the free list is being rebuilt. Only changed with the msl held.
+    PER_HEAP
+    VOLATILE(bool) loh_sweep_concurrent_p;
+
     struct gc_history
     {
         size_t gc_index;
@@ -3439,6 +3623,26 @@ protected:
     PER_HEAP
     size_t    background_mark_stack_array_length;
 
+#ifdef MULTIPLE_HEAPS
+    // Objects this heap's BGC thread took off its mark stack for idle BGC threads 
+    // to mark. Only accessed with bgc_share_lock held and scanned as background
+    // roots by foreground GCs, just like the mark stack.
+#define BGC_SHARE_BUFFER_LENGTH 256
+    PER_HEAP
+    uint8_t*  bgc_share_buffer[BGC_SHARE_BUFFER_LENGTH];
+
+    PER_HEAP
+    VOLATILE(size_t) bgc_share_count;
+
+    PER_HEAP
+    GCSpinLock bgc_share_lock;
+
+    // How many BGC threads are done with their own concurrent marking and
+    // are looking for work on other heaps.
+    PER_HEAP_ISOLATED
+    VOLATILE(int32_t) bgc_idle_thread_count;
+#endif //MULTIPLE_HEAPS
+
     PER_HEAP
     uint8_t*  background_min_overflow_address;
 
@@ -3500,6 +3704,14 @@ protected:
     PER_HEAP_ISOLATED
     size_t mark_list_size;
 
+    // Upper bound mark_list_size can grow to after ephemeral GCs overflow the mark list.
+    PER_HEAP_ISOLATED
+    size_t max_mark_list_size;
+
+    // Set when an ephemeral GC overflowed the mark list; the next GC grows the list first.
+    PER_HEAP_ISOLATED
+    BOOL mark_list_overflow;
+
     PER_HEAP
     uint8_t** mark_list_end;
 
@@ -3534,6 +3746,13 @@ protected:
     PER_HEAP
     size_t allocation_quantum;
 
+#define alloc_quantum_hot_refills (16)
+
+    // An allocation context that refilled alloc_quantum_hot_refills << n times since 
+    // the last GC gets allocation_quantum << (n + 1), up to alloc_quantum_max_shift.
+    PER_HEAP_ISOLATED
+    int alloc_quantum_max_shift;
+
     PER_HEAP
     size_t alloc_contexts_used;
 
@@ -3896,6 +4115,27 @@ public:
     static
     int n_heaps;
 
+    // The number of heaps allocation contexts are balanced to. The other heaps
+    // still participate in every GC but stop getting new allocations, so their
+    // ephemeral space gets decommitted. This is always n_heaps unless 
+    // GCDynamicHeapCount is specified.
+    static
+    int n_active_heaps;
+
+    PER_HEAP_ISOLATED
+    bool dynamic_heap_count_p;
+
+    // The current sampling window for deciding n_active_heaps - when it started,
+    // how much time we spent in blocking GCs since then and how many GCs that was.
+    PER_HEAP_ISOLATED
+    size_t dynamic_heap_count_start_time;
+
+    PER_HEAP_ISOLATED
+    size_t dynamic_heap_count_gc_time;
+
+    PER_HEAP_ISOLATED
+    size_t dynamic_heap_count_gc_count;
+
     static
     gc_heap** g_heaps;
 
@@ -4401,6 +4641,9 @@ struct loh_padding_obj
 #define heap_segment_flags_ma_pcommitted 128
 #define heap_segment_flags_loh_delete   256
 #endif //BACKGROUND_GC
+// LOH segments that objects allocated with GC_ALLOC_PINNED_OBJECT_HEAP are
+// bump allocated in. Their objects are never moved by LOH compaction.
+#define heap_segment_flags_poh          512
 
 //need to be careful to keep enough pad items to fit a relocation node
 //padded to QuadWord before the plug_skew
@@ -4491,6 +4734,18 @@ BOOL heap_segment_loh_p (heap_segment * inst)
     return !!(inst->flags & heap_segment_flags_loh);
 }
 
+inline
+BOOL heap_segment_poh_p (heap_segment * inst)
+{
+    return !!(inst->flags & heap_segment_flags_poh);
+}
+
+inline
+gc_oh_num heap_segment_oh (heap_segment * inst)
+{
+    return (heap_segment_loh_p (inst) ? oh_loh : oh_soh);
+}
+
 #ifdef BACKGROUND_GC
 inline
 BOOL heap_segment_decommitted_p (heap_segment * inst)
@@ -4556,6 +4811,9 @@ dynamic_data* gc_heap::dynamic_data_of (int gen_number)
 //
 // The value of card_size is determined empirically according to the average size of an object
 // In the code we also rely on the assumption that one card_table entry (uint32_t) covers an entire os page
+// Note that the write barriers mark a whole card byte (8 cards) with a plain 0xFF store, since setting a single
+// bit would need an interlocked OR to avoid losing concurrent updates to the neighboring cards in the byte.
+// Where FEATURE_MANUALLY_MANAGED_CARD_BUNDLES is defined the barriers also set the card bundle byte inline.
 //
 #if defined (BIT64)
 #define card_size ((size_t)(2*GC_PAGE_SIZE/card_word_width))
@@ -59,6 +59,13 @@ void GCScan::GcDhInitialScan(promote_func* fn, int condemned, int max_gen, ScanC
     pDhContext->m_iMaxGen = max_gen;
     pDhContext->m_pScanContext = sc;
 
+    // The initial scan walks the handle tables and records the handles whose primary is still unpromoted so
+    // that re-scans only have to look at those. Concurrent scans can't rely on the list since the mutator may
+    // set new primaries under us, so they always walk the tables.
+    pDhContext->m_cPending = 0;
+    pDhContext->m_fPendingValid = false;
+    pDhContext->m_fRecordPending = !sc->concurrent;
+
     // Look for dependent handle whose primary has been promoted but whose secondary has not. Promote the
     // secondary in those cases. Additionally this scan sets the m_fUnpromotedPrimaries and m_fPromoted state
     // flags in the DH context. The m_fUnpromotedPrimaries flag is the most interesting here: if this flag is
@@ -94,6 +101,18 @@ bool GCScan::GcDhReScan(ScanContext* sc)
     return Ref_ScanDependentHandlesForPromotion(pDhContext);
 }
 
+void GCScan::GcBeginHandleScanPass(bool fStealing)
+{
+    WRAPPER_NO_CONTRACT;
+    Ref_BeginHandleScanPass(fStealing);
+}
+
+bool GCScan::GcHandleScanStealing()
+{
+    WRAPPER_NO_CONTRACT;
+    return Ref_HandleScanStealing();
+}
+
 /*
  * Scan for dead weak pointers
  */
@@ -21,6 +21,14 @@
 // result we need to maintain a context between all the DH scanning methods called during a single mark phase.
 // The structure below describes this context. We allocate one of these per GC heap at Ref_Initialize time and
 // select between them based on the ScanContext passed to us by the GC during the mark phase.
+// A dependent handle whose primary was found non-null and unpromoted by the initial scan. Only these can
+// yield further secondary promotions, so re-scans walk a list of them rather than every handle table.
+struct DhPendingHandle
+{
+    Object        **m_pPrimaryRef;
+    Object        **m_pSecondaryRef;
+};
+
 struct DhContext
 {
     bool            m_fUnpromotedPrimaries;     // Did last scan find at least one non-null unpromoted primary?
@@ -29,6 +37,11 @@ struct DhContext
     int             m_iCondemned;               // The condemned generation
     int             m_iMaxGen;                  // The maximum generation
     ScanContext    *m_pScanContext;             // The GC's scan context for this phase
+    DhPendingHandle *m_pPending;                // Handles with an unpromoted primary (kept across GCs for reuse)
+    size_t          m_cPending;                 // Number of valid entries in m_pPending
+    size_t          m_cPendingMax;              // Capacity of m_pPending
+    bool            m_fRecordPending;           // Is the current table scan filling in m_pPending?
+    bool            m_fPendingValid;            // Does m_pPending cover every handle this context must revisit?
 };
 
 class GCScan
@@ -76,6 +89,13 @@ class GCScan
     // any objects were promoted as a result.
     static bool GcDhReScan(ScanContext* sc);
 
+    // Called by one server GC thread while the others wait, before a strong or dependent handle promotion
+    // pass. If fStealing is true the threads split the handle tables of all heaps between them for the pass.
+    static void GcBeginHandleScanPass(bool fStealing);
+
+    // Returns true if the current handle scan pass splits the handle tables between the GC threads.
+    static bool GcHandleScanStealing();
+
     // post-promotions callback
     static void GcPromotionsGranted (int condemned, int max_gen, 
                                      ScanContext* sc);
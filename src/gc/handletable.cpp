@@ -799,6 +799,52 @@ void HndScanHandlesForGC(HHANDLETABLE hTable, HANDLESCANPROC scanProc, uintptr_t
 #ifndef DACCESS_COMPILE
 
 
+/*
+ * HndClaimForScan
+ *
+ * Claims the table for the scan pass in dwClaim. Returns TRUE if the caller is the
+ * first to claim it for this pass (and so is the one that should scan it).
+ *
+ */
+BOOL HndClaimForScan(HHANDLETABLE hTable, uint32_t uKind, uint32_t dwClaim)
+{
+    WRAPPER_NO_CONTRACT;
+
+    _ASSERTE(uKind < HNDSCAN_CLAIM_KINDS);
+
+    // fetch the table pointer
+    HandleTable *pTable = Table(hTable);
+
+    uint32_t dwOld = pTable->rgScanClaims[uKind];
+    while (HNDSCAN_CLAIM_PASS(dwOld) != HNDSCAN_CLAIM_PASS(dwClaim))
+    {
+        uint32_t dwPrev = Interlocked::CompareExchange(&pTable->rgScanClaims[uKind], dwClaim, dwOld);
+        if (dwPrev == dwOld)
+            return TRUE;
+
+        dwOld = dwPrev;
+    }
+
+    return FALSE;
+}
+
+
+/*
+ * HndIsClaimedForScan
+ *
+ * Returns TRUE if this exact claim (pass and slot) got the table in HndClaimForScan.
+ *
+ */
+BOOL HndIsClaimedForScan(HHANDLETABLE hTable, uint32_t uKind, uint32_t dwClaim)
+{
+    WRAPPER_NO_CONTRACT;
+
+    _ASSERTE(uKind < HNDSCAN_CLAIM_KINDS);
+
+    return (VolatileLoad(&Table(hTable)->rgScanClaims[uKind]) == dwClaim);
+}
+
+
 /*
  * HndResetAgeMap
  *
@@ -128,6 +128,22 @@ void            HndVerifyTable(HHANDLETABLE hTable, const uint32_t *types, uint3
 
 void            HndNotifyGcCycleComplete(HHANDLETABLE hTable, uint32_t condemned, uint32_t maxgen);
 
+/*
+ * Scan claiming - lets server GC threads split the tables of all slots between them for a scan pass.
+ * A claim is the pass number and the claiming slot.
+ */
+#define HNDSCAN_CLAIM_NORMAL            (0)     // strong handle promotion
+#define HNDSCAN_CLAIM_DEPENDENT         (1)     // dependent handle promotion
+#define HNDSCAN_CLAIM_KINDS             (2)
+
+#define HNDSCAN_CLAIM_SLOT_BITS         (12)
+#define HNDSCAN_CLAIM_PASS_MASK         ((uint32_t)0xFFFFFFFF >> HNDSCAN_CLAIM_SLOT_BITS)
+#define HNDSCAN_MAKE_CLAIM(pass, slot)  (((uint32_t)(pass) << HNDSCAN_CLAIM_SLOT_BITS) | (uint32_t)(slot))
+#define HNDSCAN_CLAIM_PASS(claim)       ((uint32_t)(claim) >> HNDSCAN_CLAIM_SLOT_BITS)
+
+BOOL            HndClaimForScan(HHANDLETABLE hTable, uint32_t uKind, uint32_t dwClaim);
+BOOL            HndIsClaimedForScan(HHANDLETABLE hTable, uint32_t uKind, uint32_t dwClaim);
+
 /*
  * Handle counting
  */
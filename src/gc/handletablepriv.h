@@ -96,6 +96,8 @@ C_ASSERT (HANDLE_HANDLES_PER_MASK * 2 == HANDLE_HANDLES_PER_BLOCK);
 
 
 // cache layout metrics
+// There is one cache per handle type per handle table, and with server GC each heap has its own handle table
+// (picked by the allocating thread's home heap), so the interlocked cache indices are already partitioned by core.
 #define HANDLE_CACHE_TYPE_SIZE          128 // 128 == 63 handles per bank
 #define HANDLES_PER_CACHE_BANK          ((HANDLE_CACHE_TYPE_SIZE / 2) - 1)
 
@@ -524,6 +526,11 @@ struct HandleTable
     int64_t _DEBUG_TotalHandlesActuallyScanned   [MAXSTATGEN];
 #endif
 
+    /*
+     * scan pass (and slot) this table was last claimed for, per kind of scan
+     */
+    uint32_t rgScanClaims[HNDSCAN_CLAIM_KINDS];             // interlocked ops used here
+
     /*
      * primary per-type handle cache
      */
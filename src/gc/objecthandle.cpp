@@ -183,6 +183,35 @@ void CALLBACK UpdateDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pE
 #endif
 }
 
+// Append a handle to the list of dependent handles with unpromoted primaries. Returns false if the list could
+// not be grown.
+static bool DhAddPendingHandle(DhContext *pDhContext, Object **pPrimaryRef, Object **pSecondaryRef)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (pDhContext->m_cPending == pDhContext->m_cPendingMax)
+    {
+        size_t cNewMax = (pDhContext->m_cPendingMax == 0) ? 256 : (pDhContext->m_cPendingMax * 2);
+        DhPendingHandle *pNew = new (nothrow) DhPendingHandle[cNewMax];
+        if (pNew == NULL)
+            return false;
+
+        if (pDhContext->m_pPending != NULL)
+        {
+            memcpy (pNew, pDhContext->m_pPending, pDhContext->m_cPending * sizeof (DhPendingHandle));
+            delete [] pDhContext->m_pPending;
+        }
+
+        pDhContext->m_pPending = pNew;
+        pDhContext->m_cPendingMax = cNewMax;
+    }
+
+    DhPendingHandle *pEntry = &pDhContext->m_pPending[pDhContext->m_cPending++];
+    pEntry->m_pPrimaryRef = pPrimaryRef;
+    pEntry->m_pSecondaryRef = pSecondaryRef;
+    return true;
+}
+
 void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pExtraInfo, uintptr_t lp1, uintptr_t lp2)
 {
     LIMITED_METHOD_CONTRACT;
@@ -218,6 +247,15 @@ void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *p
         // promoted handles, so there's no chance of finding an additional handle being promoted on a
         // subsequent scan).
         pDhContext->m_fUnpromotedPrimaries = true;
+
+        if (pDhContext->m_fRecordPending)
+        {
+            if (!DhAddPendingHandle(pDhContext, pPrimaryRef, pSecondaryRef))
+            {
+                // Couldn't grow the list; re-scans will walk the handle tables instead.
+                pDhContext->m_fRecordPending = false;
+            }
+        }
     }
 }
     
@@ -642,6 +680,7 @@ bool Ref_Initialize()
     g_pDependentHandleContexts = new (nothrow) DhContext[n_slots];
     if (g_pDependentHandleContexts == NULL)
         goto CleanupAndFail;
+    memset (g_pDependentHandleContexts, 0, n_slots * sizeof (DhContext));
 
     return true;
 
@@ -661,6 +700,11 @@ void Ref_Shutdown()
 
     if (g_pDependentHandleContexts)
     {
+        for (int i = 0; i < getNumberOfSlots(); i++)
+        {
+            if (g_pDependentHandleContexts[i].m_pPending != NULL)
+                delete [] g_pDependentHandleContexts[i].m_pPending;
+        }
         delete [] g_pDependentHandleContexts;
         g_pDependentHandleContexts = NULL;
     }
@@ -826,6 +870,47 @@ int getSlotNumber(ScanContext* sc)
     return (IsServerHeap() ? sc->thread_number : 0);
 }
 
+// Under server GC all of a thread's handles go in the tables of its home heap's slot, so when a few
+// threads own most of the handles a few GC threads end up doing most of the handle scanning. For the
+// passes the GC enables this on (see Ref_BeginHandleScanPass), each GC thread scans its own slot's
+// tables and then helps with the other slots', claiming each table so it's only scanned once per pass.
+static bool     s_fHandleScanStealing = false;
+static uint32_t s_dwHandleScanPass = 0;
+
+// Must be called by a single GC thread while the others are waiting, before a scan pass that all of 
+// them take part in.
+void Ref_BeginHandleScanPass(bool fStealing)
+{
+    WRAPPER_NO_CONTRACT;
+
+    s_fHandleScanStealing = fStealing && IsServerHeap() && 
+                            (getNumberOfSlots() <= (1 << HNDSCAN_CLAIM_SLOT_BITS));
+
+    if (s_fHandleScanStealing)
+    {
+        // 0 is what tables that were never claimed have.
+        s_dwHandleScanPass = (s_dwHandleScanPass + 1) & HNDSCAN_CLAIM_PASS_MASK;
+        if (s_dwHandleScanPass == 0)
+            s_dwHandleScanPass = 1;
+    }
+}
+
+bool Ref_HandleScanStealing()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return s_fHandleScanStealing;
+}
+
+// How many slots a scan of this kind should look at for each bucket - all of them if we are
+// claiming tables, otherwise just the scanning thread's.
+int getNumberOfSlotsToScan(ScanContext* sc)
+{
+    WRAPPER_NO_CONTRACT;
+
+    return ((s_fHandleScanStealing && !sc->concurrent) ? getNumberOfSlots() : 1);
+}
+
 // <TODO> - reexpress as complete only like hndtable does now!!! -fmh</REVISIT_TODO>
 void Ref_EndSynchronousGC(uint32_t condemned, uint32_t maxgen)
 {
@@ -1049,15 +1134,23 @@ void Ref_TraceNormalRoots(uint32_t condemned, uint32_t maxgen, ScanContext* sc,
     uint32_t uTypeCount = (((condemned >= maxgen) && !g_theGCHeap->IsConcurrentGCInProgress()) ? 1 : _countof(types));
     uint32_t flags = (sc->concurrent) ? HNDGCF_ASYNC : HNDGCF_NORMAL;
 
+    // start with our own slot, then claim tables from the ones after it
+    int uCPUindex = getSlotNumber(sc);
+    int n_slots_to_scan = getNumberOfSlotsToScan(sc);
+    uint32_t dwClaim = HNDSCAN_MAKE_CLAIM(s_dwHandleScanPass, uCPUindex);
+
     HandleTableMap *walk = &g_HandleTableMap;
     while (walk) {
         for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
             if (walk->pBuckets[i] != NULL)
             {
-                HHANDLETABLE hTable = walk->pBuckets[i]->pTable[getSlotNumber(sc)];
-                if (hTable)
+                for (int j = 0; j < n_slots_to_scan; j++)
                 {
-                    HndScanHandlesForGC(hTable, PromoteObject, uintptr_t(sc), uintptr_t(fn), types, uTypeCount, condemned, maxgen, flags);
+                    HHANDLETABLE hTable = walk->pBuckets[i]->pTable[(uCPUindex + j) % getNumberOfSlots()];
+                    if (hTable && ((n_slots_to_scan == 1) || HndClaimForScan(hTable, HNDSCAN_CLAIM_NORMAL, dwClaim)))
+                    {
+                        HndScanHandlesForGC(hTable, PromoteObject, uintptr_t(sc), uintptr_t(fn), types, uTypeCount, condemned, maxgen, flags);
+                    }
                 }
             }
         walk = walk->pNext;
@@ -1205,6 +1298,13 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
     // tables handled by other threads.
     bool fAnyPromotions = false;
 
+    // If we are claiming tables the first iteration claims them and the following ones only rescan the
+    // tables we got.
+    int uCPUindex = getSlotNumber(pDhContext->m_pScanContext);
+    int n_slots_to_scan = getNumberOfSlotsToScan(pDhContext->m_pScanContext);
+    uint32_t dwClaim = HNDSCAN_MAKE_CLAIM(s_dwHandleScanPass, uCPUindex);
+    bool fFirstIteration = true;
+
     // Keep rescanning the table while both the following conditions are true:
     //  1) There's at least primary object left that could have been promoted.
     //  2) We performed at least one secondary promotion (which could have caused a primary promotion) on the
@@ -1220,6 +1320,44 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
         pDhContext->m_fUnpromotedPrimaries = false;
         pDhContext->m_fPromoted = false;
 
+        if (pDhContext->m_fPendingValid)
+        {
+            // Only the handles the initial scan found with an unpromoted primary can lead to more
+            // promotions. Drop the ones whose primary got promoted (after promoting their secondary) and
+            // keep the rest for the next iteration.
+            DhPendingHandle *pPending = pDhContext->m_pPending;
+            size_t cKept = 0;
+            for (size_t i = 0; i < pDhContext->m_cPending; i++)
+            {
+                Object **pPrimaryRef = pPending[i].m_pPrimaryRef;
+                Object **pSecondaryRef = pPending[i].m_pSecondaryRef;
+
+                if (*pPrimaryRef == NULL)
+                    continue;
+
+                if (g_theGCHeap->IsPromoted(*pPrimaryRef))
+                {
+                    if (!g_theGCHeap->IsPromoted(*pSecondaryRef))
+                    {
+                        LOG((LF_GC|LF_ENC, LL_INFO10000, "\tPromoting secondary " LOG_OBJECT_CLASS(*pSecondaryRef)));
+                        pDhContext->m_pfnPromoteFunction(pSecondaryRef, pDhContext->m_pScanContext, 0);
+                        pDhContext->m_fPromoted = true;
+                    }
+                }
+                else
+                {
+                    pPending[cKept++] = pPending[i];
+                    pDhContext->m_fUnpromotedPrimaries = true;
+                }
+            }
+            pDhContext->m_cPending = cKept;
+
+            if (pDhContext->m_fPromoted)
+                fAnyPromotions = true;
+
+            continue;
+        }
+
         HandleTableMap *walk = &g_HandleTableMap;
         while (walk) 
         {
@@ -1227,9 +1365,20 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
             {
                 if (walk->pBuckets[i] != NULL)
                 {
-                    HHANDLETABLE hTable = walk->pBuckets[i]->pTable[getSlotNumber(pDhContext->m_pScanContext)];
-                    if (hTable)
+                    for (int j = 0; j < n_slots_to_scan; j++)
                     {
+                        HHANDLETABLE hTable = walk->pBuckets[i]->pTable[(uCPUindex + j) % getNumberOfSlots()];
+                        if (!hTable)
+                            continue;
+
+                        if ((n_slots_to_scan > 1) &&
+                            !(fFirstIteration ? 
+                              HndClaimForScan(hTable, HNDSCAN_CLAIM_DEPENDENT, dwClaim) :
+                              HndIsClaimedForScan(hTable, HNDSCAN_CLAIM_DEPENDENT, dwClaim)))
+                        {
+                            continue;
+                        }
+
                         HndScanHandlesForGC(hTable,
                                             PromoteDependentHandle,
                                             uintptr_t(pDhContext->m_pScanContext),
@@ -1244,6 +1393,16 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
             walk = walk->pNext;
         }
 
+        fFirstIteration = false;
+
+        // A complete table scan that managed to record every unpromoted primary lets all further
+        // iterations, including the GC's later re-scans, use the pending list.
+        if (pDhContext->m_fRecordPending)
+        {
+            pDhContext->m_fRecordPending = false;
+            pDhContext->m_fPendingValid = true;
+        }
+
         if (pDhContext->m_fPromoted)
             fAnyPromotions = true;
 
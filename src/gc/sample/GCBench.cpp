@@ -0,0 +1,364 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+//
+// GCBench.cpp
+//
+
+//
+//  A microbenchmark that drives the standalone GC through the same environment as GCSample.cpp.
+//
+//  Every iteration allocates one object whose size is picked from a set of size classes, or a large
+//  object with the requested probability. A fixed-size ring of strong handles acts as the live set:
+//  a new object replaces a random ring entry with the survival probability, otherwise it is stored
+//  into a field of a random survivor so that old-to-young references exercise the card table.
+//  A fraction of the survivors is additionally held by pinned handles.
+//
+//  At the end the benchmark reports allocation throughput, GC counts per generation, the pause
+//  percentiles measured around allocations that triggered a GC, and the peak heap size observed
+//  after a GC. GC settings are read from COMPlus_* environment variables by the sample environment,
+//  so the same run can be repeated per GC configuration.
+//
+//  Usage: gcbench [-iterations N] [-survivors N] [-survivalpct P] [-pinpct P] [-lohpct P] [-seed N]
+//
+//  Like the rest of the sample environment this is single threaded.
+//
+
+#include "common.h"
+
+#include "gcenv.h"
+
+#include "gc.h"
+#include "objecthandle.h"
+
+#include "gcdesc.h"
+
+class BenchObject : Object {
+public:
+    Object * m_pNext;
+};
+
+struct BenchMethodTable
+{
+    // GCDesc
+    CGCDescSeries m_series[1];
+    size_t m_numSeries;
+
+    // The actual methodtable
+    MethodTable m_MT;
+};
+
+static const uint32_t s_smallSizes[] = { 32, 48, 64, 96, 128, 256, 512 };
+static const size_t SmallSizeCount = sizeof(s_smallSizes) / sizeof(s_smallSizes[0]);
+
+// Comfortably above the large object threshold
+static const uint32_t LargeObjectSize = 100 * 1024;
+
+// Pauses beyond this count are not recorded individually, but still counted
+static const size_t MaxRecordedPauses = 100000;
+
+static const size_t PinnedHandleCount = 64;
+
+static BenchMethodTable s_smallMethodTables[SmallSizeCount];
+static BenchMethodTable s_largeMethodTable;
+
+static void InitMethodTable(BenchMethodTable * pBenchMT, uint32_t size, bool containsPointers)
+{
+    // GC expects the size of ObjHeader (extra void*) to be included in the size.
+    uint32_t baseSize = max((uint32_t)(sizeof(BenchObject) + sizeof(ObjHeader)), size);
+    // Add padding as necessary. GC requires the object size to be at least MIN_OBJECT_SIZE.
+    baseSize = max(baseSize, (uint32_t)MIN_OBJECT_SIZE);
+    pBenchMT->m_MT.m_baseSize = (uint32_t)ALIGN_UP(baseSize, sizeof(uintptr_t));
+    pBenchMT->m_MT.m_componentSize = 0;
+
+    if (containsPointers)
+    {
+        pBenchMT->m_MT.m_flags = MTFlag_ContainsPointers;
+
+        pBenchMT->m_numSeries = 1;
+        pBenchMT->m_series[0].SetSeriesOffset(offsetof(BenchObject, m_pNext));
+        pBenchMT->m_series[0].SetSeriesCount(1);
+        pBenchMT->m_series[0].seriessize -= pBenchMT->m_MT.m_baseSize;
+    }
+    else
+    {
+        pBenchMT->m_MT.m_flags = 0;
+        pBenchMT->m_numSeries = 0;
+    }
+}
+
+// xorshift64*, so runs are repeatable across platforms for a given seed
+static uint64_t s_randomState;
+
+static uint32_t NextRandom()
+{
+    s_randomState ^= s_randomState >> 12;
+    s_randomState ^= s_randomState << 25;
+    s_randomState ^= s_randomState >> 27;
+    return (uint32_t)((s_randomState * 2685821657736338717ULL) >> 32);
+}
+
+static bool RandomPercent(uint32_t percent)
+{
+    return (NextRandom() % 100) < percent;
+}
+
+static int64_t s_pauseTicks[MaxRecordedPauses];
+static size_t s_recordedPauses;
+static size_t s_totalPauses;
+static size_t s_peakBytesInUse;
+
+//
+// Same fast path as GCSample.cpp, except that allocations which fall back to the GC are timed
+// when they triggered a collection.
+//
+static Object * AllocateObject(MethodTable * pMT)
+{
+    alloc_context * acontext = GetThread()->GetAllocContext();
+    Object * pObject;
+
+    size_t size = pMT->GetBaseSize();
+
+    // Large objects always go to the GC, like the JIT_New fast path makes them.
+    uint8_t* result = acontext->alloc_ptr;
+    uint8_t* advance = result + size;
+    if ((size < LARGE_OBJECT_SIZE) && (advance <= acontext->alloc_limit))
+    {
+        acontext->alloc_ptr = advance;
+        pObject = (Object *)result;
+    }
+    else
+    {
+        int gcCountBefore = g_theGCHeap->CollectionCount(0);
+        int64_t start = GCToOSInterface::QueryPerformanceCounter();
+
+        pObject = g_theGCHeap->Alloc(acontext, size, pMT->ContainsPointers() ? GC_ALLOC_CONTAINS_REF : 0);
+
+        if (g_theGCHeap->CollectionCount(0) != gcCountBefore)
+        {
+            int64_t elapsed = GCToOSInterface::QueryPerformanceCounter() - start;
+            if (s_recordedPauses < MaxRecordedPauses)
+            {
+                s_pauseTicks[s_recordedPauses++] = elapsed;
+            }
+            s_totalPauses++;
+
+            size_t bytesInUse = g_theGCHeap->GetTotalBytesInUse();
+            if (bytesInUse > s_peakBytesInUse)
+                s_peakBytesInUse = bytesInUse;
+        }
+
+        if (pObject == NULL)
+            return NULL;
+    }
+
+    pObject->RawSetMethodTable(pMT);
+
+    return pObject;
+}
+
+#if defined(BIT64)
+// Card byte shift is different on 64bit.
+#define card_byte_shift     11
+#else
+#define card_byte_shift     10
+#endif
+
+#define card_byte(addr) (((size_t)(addr)) >> card_byte_shift)
+
+static void WriteBarrier(Object ** dst, Object * ref)
+{
+    *dst = ref;
+
+    // if the dst is outside of the heap (unboxed value classes) then we
+    //      simply exit
+    if (((uint8_t*)dst < g_gc_lowest_address) || ((uint8_t*)dst >= g_gc_highest_address))
+        return;
+
+    // volatile is used here to prevent fetch of g_card_table from being reordered
+    // with g_lowest/highest_address check above. See comment in code:gc_heap::grow_brick_card_tables.
+    uint8_t* pCardByte = (uint8_t *)*(volatile uint8_t **)(&g_gc_card_table) + card_byte((uint8_t *)dst);
+    if(*pCardByte != 0xFF)
+        *pCardByte = 0xFF;
+}
+
+static int __cdecl ComparePauses(const void * a, const void * b)
+{
+    int64_t left = *(const int64_t *)a;
+    int64_t right = *(const int64_t *)b;
+    return (left < right) ? -1 : ((left > right) ? 1 : 0);
+}
+
+static double PausePercentileInMs(double percentile, int64_t frequency)
+{
+    if (s_recordedPauses == 0)
+        return 0.0;
+
+    size_t index = (size_t)(percentile / 100.0 * (s_recordedPauses - 1));
+    return (double)s_pauseTicks[index] * 1000.0 / (double)frequency;
+}
+
+static bool ParseArgument(int argc, char* argv[], int * pIndex, const char * name, uint32_t * pValue)
+{
+    if (strcmp(argv[*pIndex], name) != 0 || *pIndex + 1 >= argc)
+        return false;
+
+    *pValue = (uint32_t)strtoul(argv[*pIndex + 1], NULL, 10);
+    *pIndex += 1;
+    return true;
+}
+
+extern "C" HRESULT GC_Initialize(IGCToCLR* clrToGC, IGCHeap** gcHeap, IGCHandleManager** gcHandleManager, GcDacVars* gcDacVars);
+
+int __cdecl main(int argc, char* argv[])
+{
+    uint32_t iterations = 10000000;
+    uint32_t survivors = 10000;
+    uint32_t survivalPercent = 5;
+    uint32_t pinPercent = 1;
+    uint32_t lohPercent = 0;
+    uint32_t seed = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!ParseArgument(argc, argv, &i, "-iterations", &iterations) &&
+            !ParseArgument(argc, argv, &i, "-survivors", &survivors) &&
+            !ParseArgument(argc, argv, &i, "-survivalpct", &survivalPercent) &&
+            !ParseArgument(argc, argv, &i, "-pinpct", &pinPercent) &&
+            !ParseArgument(argc, argv, &i, "-lohpct", &lohPercent) &&
+            !ParseArgument(argc, argv, &i, "-seed", &seed))
+        {
+            printf("Usage: gcbench [-iterations N] [-survivors N] [-survivalpct P] [-pinpct P] [-lohpct P] [-seed N]\n");
+            return -1;
+        }
+    }
+
+    if (survivors == 0)
+        survivors = 1;
+
+    s_randomState = (uint64_t)seed * 0x9E3779B97F4A7C15ULL + 1;
+
+    //
+    // Initialize system info
+    //
+    if (!GCToOSInterface::Initialize())
+    {
+        return -1;
+    }
+
+    //
+    // Initialize GC heap
+    //
+    GcDacVars dacVars;
+    IGCHeap *pGCHeap;
+    IGCHandleManager *pGCHandleManager;
+    if (GC_Initialize(nullptr, &pGCHeap, &pGCHandleManager, &dacVars) != S_OK)
+    {
+        return -1;
+    }
+
+    if (FAILED(pGCHeap->Initialize()))
+        return -1;
+
+    //
+    // Initialize handle manager
+    //
+    if (!pGCHandleManager->Initialize())
+        return -1;
+
+    //
+    // Initialize current thread
+    //
+    ThreadStore::AttachCurrentThread();
+
+    for (size_t i = 0; i < SmallSizeCount; i++)
+    {
+        InitMethodTable(&s_smallMethodTables[i], s_smallSizes[i], true);
+    }
+    InitMethodTable(&s_largeMethodTable, LargeObjectSize, false);
+
+    HHANDLETABLE hTable = g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()];
+
+    //
+    // Create the live set. The ring starts out empty; handles hold NULL until first replaced.
+    //
+    OBJECTHANDLE * survivorHandles = new (nothrow) OBJECTHANDLE[survivors];
+    if (survivorHandles == NULL)
+        return -1;
+
+    for (uint32_t i = 0; i < survivors; i++)
+    {
+        survivorHandles[i] = HndCreateHandle(hTable, HNDTYPE_DEFAULT, NULL);
+        if (survivorHandles[i] == NULL)
+            return -1;
+    }
+
+    OBJECTHANDLE pinnedHandles[PinnedHandleCount];
+    for (size_t i = 0; i < PinnedHandleCount; i++)
+    {
+        pinnedHandles[i] = HndCreateHandle(hTable, HNDTYPE_PINNED, NULL);
+        if (pinnedHandles[i] == NULL)
+            return -1;
+    }
+
+    uint64_t allocatedBytes = 0;
+    int64_t frequency = GCToOSInterface::QueryPerformanceFrequency();
+    int64_t start = GCToOSInterface::QueryPerformanceCounter();
+
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        MethodTable * pMT;
+        if (lohPercent != 0 && RandomPercent(lohPercent))
+            pMT = &s_largeMethodTable.m_MT;
+        else
+            pMT = &s_smallMethodTables[NextRandom() % SmallSizeCount].m_MT;
+
+        Object * p = AllocateObject(pMT);
+        if (p == NULL)
+            return -1;
+
+        allocatedBytes += pMT->GetBaseSize();
+
+        uint32_t slot = NextRandom() % survivors;
+        if (RandomPercent(survivalPercent))
+        {
+            HndAssignHandle(survivorHandles[slot], ObjectToOBJECTREF(p));
+
+            if (pinPercent != 0 && RandomPercent(pinPercent))
+            {
+                HndAssignHandle(pinnedHandles[NextRandom() % PinnedHandleCount], ObjectToOBJECTREF(p));
+            }
+        }
+        else
+        {
+            // Large objects are allocated without pointer fields, so only survivors with one can hold it
+            Object * pSurvivor = HndFetchHandle(survivorHandles[slot]);
+            if (pSurvivor != NULL && pSurvivor->RawGetMethodTable()->ContainsPointers())
+            {
+                WriteBarrier(&((BenchObject *)pSurvivor)->m_pNext, p);
+            }
+        }
+    }
+
+    int64_t elapsedTicks = GCToOSInterface::QueryPerformanceCounter() - start;
+    double elapsedSeconds = (double)elapsedTicks / (double)frequency;
+
+    qsort(s_pauseTicks, s_recordedPauses, sizeof(s_pauseTicks[0]), ComparePauses);
+
+    printf("Iterations:          %u\n", iterations);
+    printf("Elapsed:             %.3f s\n", elapsedSeconds);
+    printf("Allocated:           %.1f MB\n", (double)allocatedBytes / (1024.0 * 1024.0));
+    printf("Throughput:          %.1f MB/s, %.0f allocs/s\n",
+        (double)allocatedBytes / (1024.0 * 1024.0) / elapsedSeconds, (double)iterations / elapsedSeconds);
+    printf("Collections:         gen0 %d, gen1 %d, gen2 %d\n",
+        pGCHeap->CollectionCount(0), pGCHeap->CollectionCount(1), pGCHeap->CollectionCount(2));
+    printf("Pauses:              %u (%u recorded)\n", (unsigned)s_totalPauses, (unsigned)s_recordedPauses);
+    printf("Pause p50/p90/p99:   %.3f / %.3f / %.3f ms\n",
+        PausePercentileInMs(50.0, frequency), PausePercentileInMs(90.0, frequency), PausePercentileInMs(99.0, frequency));
+    printf("Pause max:           %.3f ms\n", PausePercentileInMs(100.0, frequency));
+    printf("Peak heap in use:    %.1f MB\n", (double)s_peakBytesInUse / (1024.0 * 1024.0));
+    printf("Heap in use:         %.1f MB\n", (double)pGCHeap->GetTotalBytesInUse() / (1024.0 * 1024.0));
+
+    return 0;
+}
@@ -199,6 +199,17 @@ int __cdecl main(int argc, char* argv[])
     if (oh == NULL)
         return -1;
 
+    // Allocate another instance on the pinned object heap. It is never moved, so it keeps its
+    // address through all the GCs below.
+    Object * pPinned = g_theGCHeap->Alloc(GetThread()->GetAllocContext(), pMyMethodTable->GetBaseSize(), GC_ALLOC_PINNED_OBJECT_HEAP);
+    if (pPinned == NULL)
+        return -1;
+    pPinned->RawSetMethodTable(pMyMethodTable);
+
+    OBJECTHANDLE ohPinned = HndCreateHandle(g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()], HNDTYPE_DEFAULT, pPinned);
+    if (ohPinned == NULL)
+        return -1;
+
     for (int i = 0; i < 1000000; i++)
     {
         Object * pBefore = ((My *)HndFetchHandle(oh))->m_pOther1;
@@ -231,6 +242,10 @@ int __cdecl main(int argc, char* argv[])
     // Verify that the weak handle got cleared by the GC
     assert(HndFetchHandle(ohWeak) == NULL);
 
+    // Verify that the pinned object didn't move
+    assert(HndFetchHandle(ohPinned) == pPinned);
+    HndDestroyHandle(HndGetHandleTable(ohPinned), HNDTYPE_DEFAULT, ohPinned);
+
     printf("Done\n");
 
     return 0;
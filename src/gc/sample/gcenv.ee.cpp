@@ -286,14 +286,56 @@ bool GCToEEInterface::EagerFinalized(Object* obj)
     return false;
 }
 
+// Config values are read from COMPlus_<key> environment variables and parsed as hex, like CLRConfig
+// does, so GC settings can be varied per run without the rest of the runtime.
+static bool GetEnvironmentConfigValue(const char* key, uint64_t* value)
+{
+    char name[256];
+    int length = snprintf(name, sizeof(name), "COMPlus_%s", key);
+    if (length < 0 || (size_t)length >= sizeof(name))
+    {
+        return false;
+    }
+
+    const char* str = getenv(name);
+    if (str == NULL || *str == '\0')
+    {
+        return false;
+    }
+
+    char* end;
+    uint64_t result = strtoull(str, &end, 16);
+    if (*end != '\0')
+    {
+        return false;
+    }
+
+    *value = result;
+    return true;
+}
+
 bool GCToEEInterface::GetBooleanConfigValue(const char* key, bool* value)
 {
-    return false;
+    uint64_t result;
+    if (!GetEnvironmentConfigValue(key, &result))
+    {
+        return false;
+    }
+
+    *value = (result != 0);
+    return true;
 }
 
 bool GCToEEInterface::GetIntConfigValue(const char* key, int64_t* value)
 {
-    return false;
+    uint64_t result;
+    if (!GetEnvironmentConfigValue(key, &result))
+    {
+        return false;
+    }
+
+    *value = (int64_t)result;
+    return true;
 }
 
 bool GCToEEInterface::GetStringConfigValue(const char* key, const char** value)
@@ -355,3 +397,13 @@ inline void GCToEEInterface::AnalyzeSurvivorsFinished(int condemnedGeneration)
 {
     
 }
+
+uint32_t GCToEEInterface::GetCapabilityVersion(GCToEECapability capability)
+{
+    return 0;
+}
+
+bool GCToEEInterface::GetNumaTopology(uint16_t* highestNode)
+{
+    return false;
+}
@@ -307,7 +307,28 @@ inline void SoftwareWriteWatch::ClearDirty(void *baseAddress, size_t regionByteS
     uint8_t *tableBaseAddress;
     size_t tableRegionByteSize;
     TranslateToTableRegion(baseAddress, regionByteSize, &tableBaseAddress, &tableRegionByteSize);
-    memset(tableBaseAddress, 0, tableRegionByteSize);
+
+    // Most of the table is usually already clean when it is reset, so only store to the words that have dirty bytes. This
+    // avoids dirtying cache lines of the table for untouched ranges of the heap, which the write barrier would then have to
+    // bring back in.
+    uint8_t *tableRegionEnd = tableBaseAddress + tableRegionByteSize;
+    uint8_t *blockStart = ALIGN_UP(tableBaseAddress, sizeof(size_t));
+    uint8_t *blockEnd = ALIGN_DOWN(tableRegionEnd, sizeof(size_t));
+    if (blockStart >= blockEnd)
+    {
+        memset(tableBaseAddress, 0, tableRegionByteSize);
+        return;
+    }
+
+    memset(tableBaseAddress, 0, blockStart - tableBaseAddress);
+    for (size_t *block = reinterpret_cast<size_t *>(blockStart); block < reinterpret_cast<size_t *>(blockEnd); ++block)
+    {
+        if (*block != 0)
+        {
+            *block = 0;
+        }
+    }
+    memset(blockEnd, 0, tableRegionEnd - blockEnd);
 }
 
 inline void SoftwareWriteWatch::SetDirty(void *address, size_t writeByteSize)
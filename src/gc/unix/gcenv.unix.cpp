@@ -135,7 +135,9 @@ static uint8_t* g_helperPage = 0;
 static pthread_mutex_t g_flushProcessWriteBuffersMutex;
 
 size_t GetRestrictedPhysicalMemoryLimit();
+size_t GetRestrictedPhysicalMemoryHigh();
 bool GetPhysicalMemoryUsed(size_t* val);
+bool GetPhysicalMemoryPressure(uint32_t* val);
 bool GetCpuLimit(uint32_t* val);
 
 static size_t g_RestrictedPhysicalMemoryLimit = 0;
@@ -833,8 +835,14 @@ void GCToOSInterface::GetMemoryStatus(uint32_t* memory_load, uint64_t* available
         // We do this only when we have the total physical memory available.
         if (total > 0 && GetPhysicalMemoryUsed(&used))
         {
+            // The cgroup gets throttled once it goes over memory.high, so as far as we are
+            // concerned that's how much memory there is.
+            size_t high = GetRestrictedPhysicalMemoryHigh();
+            if (high != 0 && high < total)
+                total = high;
+
             available = total > used ? total-used : 0; 
-            load = (uint32_t)(((float)used * 100) / (float)total);
+            load = (used >= total) ? 100 : (uint32_t)(((float)used * 100) / (float)total);
         }
 
         if (memory_load != nullptr)
@@ -847,6 +855,16 @@ void GCToOSInterface::GetMemoryStatus(uint32_t* memory_load, uint64_t* available
         *available_page_file = 0;
 }
 
+// Get the memory pressure stall information
+// Parameters:
+//  pressure - The percentage of recent time some threads were stalled waiting for memory
+// Return:
+//  true if the OS reports it, false otherwise.
+bool GCToOSInterface::GetMemoryPressure(uint32_t* pressure)
+{
+    return GetPhysicalMemoryPressure(pressure);
+}
+
 // Get a high precision performance counter
 // Return:
 //  The counter value
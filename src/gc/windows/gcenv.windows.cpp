@@ -1229,6 +1229,17 @@ void GCToOSInterface::GetMemoryStatus(uint32_t* memory_load, uint64_t* available
     }
 }
 
+// Get the memory pressure stall information
+// Parameters:
+//  pressure - The percentage of recent time some threads were stalled waiting for memory
+// Return:
+//  true if the OS reports it, false otherwise.
+bool GCToOSInterface::GetMemoryPressure(uint32_t* pressure)
+{
+    UNREFERENCED_PARAMETER(pressure);
+    return false;
+}
+
 // Get a high precision performance counter
 // Return:
 //  The counter value
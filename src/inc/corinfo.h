@@ -217,11 +217,11 @@ TODO: Talk about initializing strutures before use
 #endif
 #endif
 
-SELECTANY const GUID JITEEVersionIdentifier = { /* d609bed1-7831-49fc-bd49-b6f054dd4d46 */
-    0xd609bed1,
-    0x7831,
-    0x49fc,
-    {0xbd, 0x49, 0xb6, 0xf0, 0x54, 0xdd, 0x4d, 0x46}
+SELECTANY const GUID JITEEVersionIdentifier = { /* b1e7f3a2-5c84-4d19-8e6b-2a9f0c3d7e51 */
+    0xb1e7f3a2,
+    0x5c84,
+    0x4d19,
+    {0x8e, 0x6b, 0x2a, 0x9f, 0x0c, 0x3d, 0x7e, 0x51}
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -660,6 +660,9 @@ enum CorInfoHelpFunc
 
     CORINFO_HELP_GVMLOOKUP_FOR_SLOT,        // Resolve a generic virtual method target from this pointer and runtime method handle 
 
+    CORINFO_HELP_PATCHPOINT,                // Notify the runtime that a tier-0 loop is hot; returns the new patchpoint counter
+    CORINFO_HELP_CLASSPROFILE,              // Record the class of the 'this' object at a virtual call site in tier-0 code
+
     CORINFO_HELP_COUNT,
 };
 
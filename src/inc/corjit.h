@@ -395,6 +395,24 @@ public:
         UINT32 ExecutionCount;
     };
 
+    // Instrumented tier-0 code may also record the classes seen at virtual call sites.
+    // These records live in the same buffer, after the block counts; each one takes
+    // up the BlockCounts tuples needed to hold it. ILOffset is the IL offset of the
+    // call tagged with CLASS_FLAG, so it never matches a block. Count is the number
+    // of calls seen and ClassTable is a reservoir sample of their receiver classes.
+    struct ClassProfile
+    {
+        enum
+        {
+            CLASS_FLAG = 0x80000000,
+            SIZE       = 8
+        };
+
+        UINT32               ILOffset;
+        UINT32               Count;
+        CORINFO_CLASS_HANDLE ClassTable[SIZE];
+    };
+
     // allocate a basic block profile buffer where execution counts will be stored
     // for jitted basic blocks.
     virtual HRESULT allocMethodBlockCounts (
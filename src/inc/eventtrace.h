@@ -141,6 +141,10 @@ namespace ETW
         // GCSampledObjectAllocation*Keyword was used)
         static int s_nCustomMsBetweenEvents;
 
+        // Mean distance, in bytes allocated per thread, between GCAllocationSampled
+        // events. Read from COMPLUS_AllocationSamplingInterval.
+        static UINT64 s_allocationSamplingInterval;
+
     public:
         // This customizes the type logging behavior in LogTypeAndParametersIfNecessary
         enum TypeLogBehavior
@@ -166,6 +170,8 @@ namespace ETW
         static void PostRegistrationInit();
         static BOOL IsHeapAllocEventEnabled();
         static void SendObjectAllocatedEvent(Object * pObject);
+        static BOOL IsAllocationSamplingEnabled();
+        static void SampleObjectAllocation(Object * pObject);
         static CrstBase * GetHashCrst();
         static VOID LogTypeAndParametersIfNecessary(BulkTypeEventLogger * pBulkTypeEventLogger, ULONGLONG thAsAddr, TypeLogBehavior typeLogBehavior);
         static VOID OnModuleUnload(Module * pModule);
@@ -181,6 +187,7 @@ namespace ETW
         static BOOL AddOrReplaceTypeLoggingInfo(ETW::LoggedTypesFromModule * pLoggedTypesFromModule, const ETW::TypeLoggingInfo * pTypeLoggingInfo);
         static int GetDefaultMsBetweenEvents();
         static VOID OnTypesKeywordTurnedOff();
+        static UINT64 GetNextAllocationSampleDistance(Thread * pThread);
     };
 
 #endif // FEATURE_REDHAWK
@@ -217,6 +217,10 @@ private:
 
     size_t *             m_pPrivatePerfCounter_LoaderBytes;
 
+    // Bytes committed by all loader heaps in the process. Updated only when pages are
+    // committed or a heap is destroyed, so the cost is one interlocked add per commit.
+    static LONG64        s_totalCommittedBytes;
+
     DWORD                m_Options;
 
     LoaderHeapFreeBlock *m_pFirstFreeBlock;
@@ -268,6 +272,17 @@ public:
 public:
     BOOL                m_fExplicitControl;  // Am I a LoaderHeap or an ExplicitControlLoaderHeap?
 
+#ifndef DACCESS_COMPILE
+    // Returns the number of bytes currently committed by all loader heaps, including the
+    // loader code heaps used for jitted code.
+    static UINT64 GetTotalCommittedBytes()
+    {
+        LIMITED_METHOD_CONTRACT;
+        // Read through an interlocked operation so the 64-bit value is not torn on 32-bit platforms.
+        return (UINT64)InterlockedCompareExchange64(&s_totalCommittedBytes, 0, 0);
+    }
+#endif
+
 #ifdef DACCESS_COMPILE
 public:
     void EnumMemoryRegions(enum CLRDataEnumMemoryFlags flags);
@@ -430,6 +445,14 @@ inline CRITSEC_COOKIE CreateLoaderHeapLock()
 //===============================================================================
 // The LoaderHeap is the black-box heap and has a Backout() method but none
 // of the advanced features that let you control address ranges.
+//
+// Every allocation takes m_CriticalSection, but it is only held for the bump
+// allocation itself (and the occasional commit of more pages). Handing out
+// per-thread chunks would not combine well with Backout(), which AllocMemTracker
+// uses when a type load fails: it rolls back m_pAllocPtr when the block is the
+// most recent allocation and otherwise adds it to the heap's free list, both of
+// which are shared heap state. Tail space left in per-thread chunks would also
+// be lost to every heap of every LoaderAllocator.
 //===============================================================================
 typedef DPTR(class LoaderHeap) PTR_LoaderHeap;
 class LoaderHeap : public UnlockedLoaderHeap, public ILoaderHeapBackout
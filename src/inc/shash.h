@@ -22,6 +22,10 @@
 //    (@todo: this can be remedied by delaying destruction of old tables during reallocation, e.g. during GC)
 // - Remove operations may be asynchronous with Lookup/Add, unless elements are also deallocated. (In which 
 //    case full synchronization is required)
+//
+// These properties rely on each slot being a single element_t that is written in one store, with Null and Deleted
+// encoded in the element itself. A layout with separate per-slot control bytes (as in SIMD-probed tables) would
+// need both to be published in order for lock-free readers, so it is not a drop-in replacement for SHash.
 
 // Common "gotchas":
 // - The Add method never replaces an element. The new element will be added even if an element with the same
@@ -14,6 +14,11 @@
    It is meant to have very low overhead and can not cause deadlocks, etc.  It is
    however thread safe */
 
+/* Each thread writes to its own ThreadStressLog without taking a lock; the global lock is only
+   taken when a thread's log is first created or recycled. A message stores the format string
+   pointer and raw arguments, and formatting happens later in the reader (SOS !dumplog), so the
+   write cost is a facility check plus a few stores. */
+
 /* The log has a very simple structure, and it meant to be dumped from a NTSD 
    extention (eg. strike). There is no memory allocation system calls etc to purtub things */
 
@@ -2,6 +2,10 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 // See the LICENSE file in the project root for more information.
 
+// This wrapper only times JIT-EE calls made by the current compilation (MEASURE_CLRAPI_CALLS).
+// Recording the EE's answers and replaying them without the VM is done by SuperPMI, see
+// src/ToolBox/superpmi (superpmi-shim-collector to record, superpmi to replay, mcs to manage).
+
 #define API_ENTER(name) wrapComp->CLR_API_Enter(API_##name);
 #define API_LEAVE(name) wrapComp->CLR_API_Leave(API_##name);
 
@@ -127,6 +127,16 @@ private:
 public:
     MemStatsAllocator* getMemStatsAllocator(CompMemKind kind);
     void finishMemStats();
+
+    UINT64 getBytesAllocatedByKind(CompMemKind kind)
+    {
+        return m_stats.allocSzByKind[kind];
+    }
+
+    static const char* getCompMemKindName(CompMemKind kind)
+    {
+        return MemStats::s_CompMemKindNames[kind];
+    }
     void dumpMemStats(FILE* file);
 
     static void dumpMaxMemStats(FILE* file);
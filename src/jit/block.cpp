@@ -343,6 +343,10 @@ void BasicBlock::dspFlags()
     {
         printf("bwd ");
     }
+    if (bbFlags & BBF_BACKWARD_JUMP_TARGET)
+    {
+        printf("bwd-target ");
+    }
     if (bbFlags & BBF_RETLESS_CALL)
     {
         printf("retless ");
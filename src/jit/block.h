@@ -447,6 +447,7 @@ struct BasicBlock : private LIR::Range
 // clang-format on
 
 #define BBF_DOMINATED_BY_EXCEPTIONAL_ENTRY 0x400000000 // Block is dominated by exceptional entry.
+#define BBF_BACKWARD_JUMP_TARGET    0x800000000 // Block is the target of a backward jump/switch arc
 
 // Flags that relate blocks to loop structure.
 
@@ -4499,10 +4499,8 @@ void CodeGen::genSIMDIntrinsicBinOp(GenTreeSIMD* simdNode)
 
     genConsumeOperands(simdNode);
     regNumber op1Reg = op1->gtRegNum;
-    regNumber op2Reg = op2->gtRegNum;
 
     assert(genIsValidFloatReg(op1Reg));
-    assert(genIsValidFloatReg(op2Reg));
     assert(genIsValidFloatReg(targetReg));
 
     // TODO-ARM64-CQ Contain integer constants where posible
@@ -4511,7 +4509,18 @@ void CodeGen::genSIMDIntrinsicBinOp(GenTreeSIMD* simdNode)
     emitAttr    attr = (simdNode->gtSIMDSize > 8) ? EA_16BYTE : EA_8BYTE;
     insOpts     opt  = genGetSimdInsOpt(attr, baseType);
 
-    getEmitter()->emitIns_R_R_R(ins, attr, targetReg, op1Reg, op2Reg, opt);
+    if (op2->isContained())
+    {
+        // Lowering only contains a zero vector for the compares that have a compare-with-zero form.
+        assert(op2->IsIntegralConstVector(0));
+        getEmitter()->emitIns_R_R(ins, attr, targetReg, op1Reg, opt);
+    }
+    else
+    {
+        regNumber op2Reg = op2->gtRegNum;
+        assert(genIsValidFloatReg(op2Reg));
+        getEmitter()->emitIns_R_R_R(ins, attr, targetReg, op1Reg, op2Reg, opt);
+    }
 
     genProduceReg(simdNode);
 }
@@ -4538,19 +4547,24 @@ void CodeGen::genSIMDIntrinsicRelOp(GenTreeSIMD* simdNode)
     var_types targetType = simdNode->TypeGet();
 
     genConsumeOperands(simdNode);
-    regNumber op1Reg   = op1->gtRegNum;
-    regNumber op2Reg   = op2->gtRegNum;
-    regNumber otherReg = op2Reg;
+    regNumber op1Reg = op1->gtRegNum;
 
     instruction ins  = getOpForSIMDIntrinsic(SIMDIntrinsicEqual, baseType);
     emitAttr    attr = (simdNode->gtSIMDSize > 8) ? EA_16BYTE : EA_8BYTE;
     insOpts     opt  = genGetSimdInsOpt(attr, baseType);
 
-    // TODO-ARM64-CQ Contain integer constants where possible
-
     regNumber tmpFloatReg = simdNode->GetSingleTempReg(RBM_ALLFLOAT);
 
-    getEmitter()->emitIns_R_R_R(ins, attr, tmpFloatReg, op1Reg, op2Reg, opt);
+    if (op2->isContained())
+    {
+        // Comparison against a zero vector; see Lowering::ContainCheckSIMD.
+        assert(op2->IsIntegralConstVector(0));
+        getEmitter()->emitIns_R_R(ins, attr, tmpFloatReg, op1Reg, opt);
+    }
+    else
+    {
+        getEmitter()->emitIns_R_R_R(ins, attr, tmpFloatReg, op1Reg, op2->gtRegNum, opt);
+    }
 
     if ((simdNode->gtFlags & GTF_SIMD12_OP) != 0)
     {
@@ -4510,6 +4510,9 @@ void CodeGen::genCheckUseBlockInit()
             continue;
         }
 
+        // Tracked locals are only zeroed when liveness shows them live into the first block, i.e. when some
+        // read is not preceded by a write. Untracked locals (most large structs) and localloc buffers have no
+        // such information, so they are zeroed whenever the method's IL asks for it with localsinit.
         if (compiler->info.compInitMem || varTypeIsGC(varDsc->TypeGet()) || (varDsc->lvStructGcCount > 0) ||
             varDsc->lvMustInit)
         {
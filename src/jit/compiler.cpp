@@ -3466,6 +3466,8 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
     fgBlockCounts                = nullptr;
     fgProfileData_ILSizeMismatch = false;
     fgNumProfileRuns             = 0;
+    fgClassProbeSites            = nullptr;
+    fgClassProbeCount            = 0;
     if (jitFlags->IsSet(JitFlags::JIT_FLAG_BBOPT))
     {
         assert(!compIsForInlining());
@@ -4343,6 +4345,10 @@ void Compiler::compFunctionTraceEnd(void* methodCodePtr, ULONG methodCodeSize, b
 // For an overview of the structure of the JIT, see:
 //   https://github.com/dotnet/coreclr/blob/master/Documentation/botr/ryujit-overview.md
 //
+// Under MinOpts (which is what tier0 uses) the optimization phases below are skipped, but importation, morph,
+// lowering, LSRA and emission still run, since they are what produce correct LIR and GC info; there is no
+// separate IL-to-LIR path for simple methods.
+//
 void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags* compileFlags)
 {
     if (compIsForInlining())
@@ -4450,6 +4456,14 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
         fgInstrumentMethod();
     }
 
+    // Tier-0 methods with loops get patchpoints so the runtime can see that they
+    // are hot even if they are only called once.
+    if (compileFlags->IsSet(JitFlags::JIT_FLAG_TIER0) && fgHasBackwardJump &&
+        (JitConfig.TC_OnStackReplacement() != 0) && !opts.IsReadyToRun())
+    {
+        fgInsertPatchpoints();
+    }
+
     // We could allow ESP frames. Just need to reserve space for
     // pushing EBP if the method becomes an EBP-frame after an edit.
     // Note that requiring a EBP Frame disallows double alignment.  Thus if we change this
@@ -4560,6 +4574,11 @@ void Compiler::compCompile(void** methodCodePtr, ULONG* methodCodeSize, JitFlags
         optOptimizeLoops();
         EndPhase(PHASE_OPTIMIZE_LOOPS);
 
+#ifdef DEBUG
+        // Look for loops we could vectorize, before cloning duplicates them.
+        optFindVectorizableLoops();
+#endif // DEBUG
+
         // Clone loops with optimization opportunities, and
         // choose the one based on dynamic condition evaluation.
         optCloneLoops();
@@ -7960,6 +7979,13 @@ void JitTimer::PrintCsvHeader()
             fprintf(fp, "\"Executable Code Bytes\",");
             fprintf(fp, "\"GC Info Bytes\",");
             fprintf(fp, "\"Total Bytes Allocated\",");
+            fprintf(fp, "\"Total Bytes Used\",");
+#if MEASURE_MEM_ALLOC
+            for (int i = 0; i < CMK_Count; i++)
+            {
+                fprintf(fp, "\"%s Bytes\",", ArenaAllocator::getCompMemKindName((CompMemKind)i));
+            }
+#endif // MEASURE_MEM_ALLOC
             fprintf(fp, "\"Total Cycles\",");
             fprintf(fp, "\"CPS\"\n");
         }
@@ -8027,6 +8053,13 @@ void JitTimer::PrintCsvMethodStats(Compiler* comp)
     fprintf(fp, "%u,", comp->info.compNativeCodeSize);
     fprintf(fp, "%Iu,", comp->compInfoBlkSize);
     fprintf(fp, "%Iu,", comp->compGetArenaAllocator()->getTotalBytesAllocated());
+    fprintf(fp, "%Iu,", comp->compGetArenaAllocator()->getTotalBytesUsed());
+#if MEASURE_MEM_ALLOC
+    for (int i = 0; i < CMK_Count; i++)
+    {
+        fprintf(fp, "%I64u,", comp->compGetArenaAllocator()->getBytesAllocatedByKind((CompMemKind)i));
+    }
+#endif // MEASURE_MEM_ALLOC
     fprintf(fp, "%I64u,", m_info.m_totalCycles);
     fprintf(fp, "%f\n", CycleTimer::CyclesPerSecond());
     fclose(fp);
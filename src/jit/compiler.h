@@ -3199,7 +3199,9 @@ public:
     void lvaUpdateClass(unsigned varNum, CORINFO_CLASS_HANDLE clsHnd, bool isExact = false);
     void lvaUpdateClass(unsigned varNum, GenTree* tree, CORINFO_CLASS_HANDLE stackHandle = nullptr);
 
-#define MAX_NumOfFieldsInPromotableStruct 4 // Maximum number of fields in promotable struct
+// Maximum number of fields in promotable struct. This is bounded by the byte-sized field offsets
+// in lvaStructFieldInfo: MaxOffset in CanPromoteStructType must stay below 256.
+#define MAX_NumOfFieldsInPromotableStruct 7
 
     // Info about struct type fields.
     struct lvaStructFieldInfo
@@ -3417,7 +3419,8 @@ public:
                              CORINFO_CONTEXT_HANDLE* contextHandle,
                              CORINFO_CONTEXT_HANDLE* exactContextHandle,
                              bool                    isLateDevirtualization,
-                             bool                    isExplicitTailCall);
+                             bool                    isExplicitTailCall,
+                             IL_OFFSET               ilOffset = BAD_IL_OFFSET);
 
     //=========================================================================
     //                          PROTECTED
@@ -4559,6 +4562,11 @@ public:
     // Does value-numbering for an intrinsic tree.
     void fgValueNumberIntrinsic(GenTree* tree);
 
+#ifdef FEATURE_HW_INTRINSICS
+    // Does value-numbering for a GT_HWIntrinsic tree
+    void fgValueNumberHWIntrinsic(GenTree* tree);
+#endif // FEATURE_HW_INTRINSICS
+
     // Does value-numbering for a call.  We interpret some helper calls.
     void fgValueNumberCall(GenTreeCall* call);
 
@@ -5137,6 +5145,30 @@ protected:
     UINT32                    fgBlockCountsCount;
     UINT32                    fgNumProfileRuns;
 
+    // Virtual call sites in instrumented tier-0 code that record their receiver classes
+    struct ClassProbeSite
+    {
+        GenTreeCall*    call;
+        IL_OFFSET       ilOffset;
+        ClassProbeSite* next;
+    };
+
+    ClassProbeSite* fgClassProbeSites;
+    unsigned        fgClassProbeCount;
+
+    // Number of BlockCounts tuples taken up by one ICorJitInfo::ClassProfile record
+    static unsigned fgClassProfileBlockCountsSize()
+    {
+        return (sizeof(ICorJitInfo::ClassProfile) + sizeof(ICorJitInfo::BlockCounts) - 1) /
+               sizeof(ICorJitInfo::BlockCounts);
+    }
+
+    struct LikelyClass
+    {
+        CORINFO_CLASS_HANDLE clsHandle;
+        unsigned             likelihood; // percentage of the sampled calls
+    };
+
     unsigned fgStressBBProf()
     {
 #ifdef DEBUG
@@ -5156,7 +5188,11 @@ protected:
 
     bool fgHaveProfileData();
     bool fgGetProfileWeightForBasicBlock(IL_OFFSET offset, unsigned* weight);
+    bool fgClassProbesEnabled();
+    void fgAddClassProbeSite(GenTreeCall* call, IL_OFFSET ilOffset);
+    unsigned fgGetLikelyClasses(IL_OFFSET ilOffset, LikelyClass* likelyClasses, unsigned maxLikelyClasses);
     void fgInstrumentMethod();
+    void fgInsertPatchpoints();
 
 public:
     // fgIsUsingProfileWeights - returns true if we have real profile data for this method
@@ -5699,6 +5735,13 @@ public:
     // Optionally clone loops in the loop table.
     void optCloneLoops();
 
+#ifdef DEBUG
+    // Identify simple counted loops that an auto-vectorizer could handle.
+    void optFindVectorizableLoops();
+    bool optIsVectorizableLoop(unsigned loopNum);
+    static fgWalkPreFn optVectorizableLoopTreeVisitor;
+#endif // DEBUG
+
     // Clone loop "loopInd" in the loop table.
     void optCloneLoop(unsigned loopInd, LoopCloneContext* context);
 
@@ -6308,7 +6351,13 @@ public:
                                              CORINFO_METHOD_HANDLE methodHandle,
                                              CORINFO_CLASS_HANDLE  classHandle,
                                              unsigned              methodAttr,
-                                             unsigned              classAttr);
+                                             unsigned              classAttr,
+                                             unsigned              likelihood = 0);
+
+    bool addLikelyClassGuardedDevirtualizationCandidates(GenTreeCall*           call,
+                                                         CORINFO_METHOD_HANDLE  baseMethod,
+                                                         CORINFO_CONTEXT_HANDLE ownerType,
+                                                         IL_OFFSET              ilOffset);
 
     unsigned optMethodFlags;
 
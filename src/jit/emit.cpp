@@ -4281,6 +4281,9 @@ AGAIN:
 #endif
 
         /* Is there a chance of other jumps becoming short? */
+        /* Each pass is linear in the number of jumps and groups, and we only  */
+        /* iterate when the total shrinkage could bring another jump in range, */
+        /* so large methods typically settle within a pass or two.             */
         CLANG_FORMAT_COMMENT_ANCHOR;
 #ifdef DEBUG
 #if defined(_TARGET_ARM_)
@@ -234,6 +234,13 @@ bool Compiler::fgGetProfileWeightForBasicBlock(IL_OFFSET offset, unsigned* weigh
     noway_assert(!compIsForInlining());
     for (UINT32 i = 0; i < fgBlockCountsCount; i++)
     {
+        // Skip over class profile records
+        if ((fgBlockCounts[i].ILOffset & ICorJitInfo::ClassProfile::CLASS_FLAG) != 0)
+        {
+            i += fgClassProfileBlockCountsSize() - 1;
+            continue;
+        }
+
         if (fgBlockCounts[i].ILOffset == offset)
         {
             weight = fgBlockCounts[i].ExecutionCount;
@@ -247,6 +254,157 @@ bool Compiler::fgGetProfileWeightForBasicBlock(IL_OFFSET offset, unsigned* weigh
     return true;
 }
 
+//------------------------------------------------------------------------
+// fgClassProbesEnabled: check if virtual call sites should record the
+//   classes of their receivers
+//
+// Notes:
+//    Class profiles are only kept for instrumented tier-0 code; the tier 1
+//    compilation of the method uses them to guess for the likely classes in
+//    guarded devirtualization.
+//
+bool Compiler::fgClassProbesEnabled()
+{
+    return opts.jitFlags->IsSet(JitFlags::JIT_FLAG_BBINSTR) && opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0) &&
+           !compIsForInlining() && !opts.IsReadyToRun() && (JitConfig.JitClassProfiling() > 0);
+}
+
+//------------------------------------------------------------------------
+// fgAddClassProbeSite: note a virtual call that fgInstrumentMethod should
+//   instrument with a class probe
+//
+// Arguments:
+//    call - the virtual call
+//    ilOffset - IL offset of the call instruction, which keys the profile
+//
+void Compiler::fgAddClassProbeSite(GenTreeCall* call, IL_OFFSET ilOffset)
+{
+    assert(fgClassProbesEnabled());
+    assert(call->IsVirtual());
+    assert((ilOffset & ICorJitInfo::ClassProfile::CLASS_FLAG) == 0);
+
+    ClassProbeSite* site = new (this, CMK_Generic) ClassProbeSite;
+    site->call           = call;
+    site->ilOffset       = ilOffset;
+    site->next           = fgClassProbeSites;
+    fgClassProbeSites    = site;
+    fgClassProbeCount++;
+}
+
+//------------------------------------------------------------------------
+// fgGetLikelyClasses: find the classes the 'this' object of a virtual call
+//   was seen to have by the instrumented tier-0 code
+//
+// Arguments:
+//    ilOffset - IL offset of the call instruction
+//    likelyClasses - [OUT] array to fill in, most likely class first
+//    maxLikelyClasses - size of the array
+//
+// Returns:
+//    Number of classes found.
+//
+unsigned Compiler::fgGetLikelyClasses(IL_OFFSET ilOffset, LikelyClass* likelyClasses, unsigned maxLikelyClasses)
+{
+    if (!fgHaveProfileData())
+    {
+        return 0;
+    }
+
+    const UINT32                     key          = ilOffset | ICorJitInfo::ClassProfile::CLASS_FLAG;
+    const ICorJitInfo::ClassProfile* classProfile = nullptr;
+
+    for (UINT32 i = 0; i < fgBlockCountsCount; i++)
+    {
+        if ((fgBlockCounts[i].ILOffset & ICorJitInfo::ClassProfile::CLASS_FLAG) == 0)
+        {
+            continue;
+        }
+
+        if (fgBlockCounts[i].ILOffset == key)
+        {
+            classProfile = (const ICorJitInfo::ClassProfile*)&fgBlockCounts[i];
+            break;
+        }
+
+        i += fgClassProfileBlockCountsSize() - 1;
+    }
+
+    if ((classProfile == nullptr) || (classProfile->Count == 0))
+    {
+        return 0;
+    }
+
+    // Tally up the samples for each distinct class
+    const unsigned sampleCount =
+        min((unsigned)classProfile->Count, (unsigned)ICorJitInfo::ClassProfile::SIZE);
+    LikelyClass tally[ICorJitInfo::ClassProfile::SIZE];
+    unsigned    tallyCount   = 0;
+    unsigned    sampledCount = 0;
+
+    for (unsigned i = 0; i < sampleCount; i++)
+    {
+        CORINFO_CLASS_HANDLE clsHandle = classProfile->ClassTable[i];
+
+        // The helper bumps Count before it fills in the slot, so the last slot
+        // may not have been written yet.
+        if (clsHandle == NO_CLASS_HANDLE)
+        {
+            continue;
+        }
+
+        sampledCount++;
+        unsigned j = 0;
+
+        while ((j < tallyCount) && (tally[j].clsHandle != clsHandle))
+        {
+            j++;
+        }
+
+        if (j == tallyCount)
+        {
+            tally[j].clsHandle  = clsHandle;
+            tally[j].likelihood = 0;
+            tallyCount++;
+        }
+
+        tally[j].likelihood++;
+    }
+
+    // Most sampled first
+    for (unsigned i = 1; i < tallyCount; i++)
+    {
+        LikelyClass current = tally[i];
+        unsigned    j       = i;
+
+        while ((j > 0) && (tally[j - 1].likelihood < current.likelihood))
+        {
+            tally[j] = tally[j - 1];
+            j--;
+        }
+
+        tally[j] = current;
+    }
+
+    if (sampledCount == 0)
+    {
+        return 0;
+    }
+
+    const unsigned resultCount = min(tallyCount, maxLikelyClasses);
+
+    for (unsigned i = 0; i < resultCount; i++)
+    {
+        likelyClasses[i].clsHandle  = tally[i].clsHandle;
+        likelyClasses[i].likelihood = (tally[i].likelihood * 100) / sampledCount;
+
+        JITDUMP("Likely class at IL offset 0x%x: %p (%s), %u%% of %u samples\n", ilOffset,
+                dspPtr(likelyClasses[i].clsHandle), eeGetClassName(likelyClasses[i].clsHandle),
+                likelyClasses[i].likelihood, sampledCount);
+    }
+
+    return resultCount;
+}
+
 void Compiler::fgInstrumentMethod()
 {
     noway_assert(!compIsForInlining());
@@ -264,11 +422,15 @@ void Compiler::fgInstrumentMethod()
         countOfBlocks++;
     }
 
+    // Class profile records follow the block counts in the same buffer
+    const unsigned countOfClassProfileEntries = fgClassProbeCount * fgClassProfileBlockCountsSize();
+
     // Allocate the profile buffer
 
     ICorJitInfo::BlockCounts* profileBlockCountsStart;
 
-    HRESULT res = info.compCompHnd->allocMethodBlockCounts(countOfBlocks, &profileBlockCountsStart);
+    HRESULT res =
+        info.compCompHnd->allocMethodBlockCounts(countOfBlocks + countOfClassProfileEntries, &profileBlockCountsStart);
 
     GenTreeStmt* stmt;
 
@@ -336,6 +498,43 @@ void Compiler::fgInstrumentMethod()
         // Check that we allocated and initialized the same number of BlockCounts tuples
         noway_assert(countOfBlocks == 0);
 
+        // For each recorded virtual call site, call the class profile helper with
+        // the 'this' object before making the call:
+        //
+        //   call(obj, ...) => call(COMMA(tmp = obj, COMMA(CLASSPROFILE(tmp, profile), tmp)), ...)
+        //
+        for (ClassProbeSite* site = fgClassProbeSites; site != nullptr; site = site->next)
+        {
+            ICorJitInfo::ClassProfile* classProfile = (ICorJitInfo::ClassProfile*)currentBlockCounts;
+            classProfile->ILOffset                  = site->ilOffset | ICorJitInfo::ClassProfile::CLASS_FLAG;
+            assert(classProfile->Count == 0); // This value should already be zero-ed out
+
+            currentBlockCounts += fgClassProfileBlockCountsSize();
+
+            GenTreeCall* const call = site->call;
+
+            // The call may have been devirtualized since it was recorded.
+            if (!call->IsVirtual() || (call->gtCallObjp == nullptr))
+            {
+                continue;
+            }
+
+            JITDUMP("Adding class probe for call [%06u] at IL offset 0x%x\n", dspTreeID(call), site->ilOffset);
+
+            const unsigned tmpNum = lvaGrabTemp(true DEBUGARG("class profile tmp"));
+            GenTree*       asgNode = gtNewTempAssign(tmpNum, call->gtCallObjp);
+
+            GenTree*        profileNode = gtNewIconHandleNode((size_t)classProfile, GTF_ICON_BBC_PTR);
+            GenTreeArgList* args        = gtNewArgList(gtNewLclvNode(tmpNum, TYP_REF), profileNode);
+            GenTree*        helperCall  = gtNewHelperCallNode(CORINFO_HELP_CLASSPROFILE, TYP_VOID, args);
+
+            GenTree* callCommaNode = gtNewOperNode(GT_COMMA, TYP_REF, helperCall, gtNewLclvNode(tmpNum, TYP_REF));
+            GenTree* tmpCommaNode  = gtNewOperNode(GT_COMMA, TYP_REF, asgNode, callCommaNode);
+
+            call->gtCallObjp = tmpCommaNode;
+            call->gtFlags |= tmpCommaNode->gtFlags & GTF_GLOB_EFFECT;
+        }
+
         // Add the method entry callback node
 
         GenTree* arg;
@@ -382,6 +581,83 @@ void Compiler::fgInstrumentMethod()
     fgInsertStmtAtEnd(fgFirstBB, stmt);
 }
 
+//------------------------------------------------------------------------
+// fgInsertPatchpoints: add loop patchpoints to a tier-0 method
+//
+// Notes:
+//    Every block that is the target of a backward branch decrements a per-frame
+//    counter, and when the counter runs out calls CORINFO_HELP_PATCHPOINT with the
+//    method handle and the block's IL offset. This lets the runtime promote a method
+//    that spends its time in a loop rather than in calls, as call counting alone will
+//    never notice it. The helper returns the value to reload the counter with.
+//
+//    The conditional call is built as a QMARK and expanded by morph.
+//
+void Compiler::fgInsertPatchpoints()
+{
+    assert(opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0));
+    assert(!compIsForInlining());
+    assert(fgHasBackwardJump);
+
+    int initialCounter = JitConfig.TC_OnStackReplacement_InitialCounter();
+    if (initialCounter <= 0)
+    {
+        initialCounter = 1;
+    }
+
+    unsigned counterLclNum = BAD_VAR_NUM;
+
+    for (BasicBlock* block = fgFirstBB; block != nullptr; block = block->bbNext)
+    {
+        if ((block->bbFlags & BBF_BACKWARD_JUMP_TARGET) == 0)
+        {
+            continue;
+        }
+
+        // Handler entries must begin with the use of the exception object, and
+        // unimported blocks will be removed anyway.
+        if (((block->bbFlags & BBF_IMPORTED) == 0) || (block->bbCatchTyp != BBCT_NONE))
+        {
+            continue;
+        }
+
+        if (counterLclNum == BAD_VAR_NUM)
+        {
+            counterLclNum                  = lvaGrabTemp(true DEBUGARG("patchpoint counter"));
+            lvaTable[counterLclNum].lvType = TYP_INT;
+        }
+
+        // counter = counter - 1;
+        GenTree* counterValue = gtNewLclvNode(counterLclNum, TYP_INT);
+        GenTree* decrement    = gtNewOperNode(GT_SUB, TYP_INT, counterValue, gtNewIconNode(1));
+        GenTree* decrementAsg = gtNewTempAssign(counterLclNum, decrement);
+
+        // (counter > 0) ? nop : counter = helper(method, ilOffset);
+        GenTreeArgList* args =
+            gtNewArgList(gtNewIconEmbMethHndNode(info.compMethodHnd), gtNewIconNode(block->bbCodeOffs, TYP_INT));
+        GenTree* call     = gtNewHelperCallNode(CORINFO_HELP_PATCHPOINT, TYP_INT, args);
+        GenTree* reload   = gtNewTempAssign(counterLclNum, call);
+        GenTree* relop    = gtNewOperNode(GT_GT, TYP_INT, gtNewLclvNode(counterLclNum, TYP_INT), gtNewIconNode(0));
+        GenTree* colon    = new (this, GT_COLON) GenTreeColon(TYP_VOID, gtNewNothingNode(), reload);
+        GenTree* qmark    = gtNewQmarkNode(TYP_VOID, relop, colon);
+
+        fgInsertStmtAtBeg(block, qmark);
+        fgInsertStmtAtBeg(block, decrementAsg);
+
+        JITDUMP("Added patchpoint to " FMT_BB " (IL offset 0x%x)\n", block->bbNum, block->bbCodeOffs);
+    }
+
+    if (counterLclNum == BAD_VAR_NUM)
+    {
+        return;
+    }
+
+    // Any of the blocks above may be the first block, so the counter is
+    // initialized in a fresh scratch block.
+    fgEnsureFirstBBisScratch();
+    fgInsertStmtAtEnd(fgFirstBB, gtNewTempAssign(counterLclNum, gtNewIconNode(initialCounter, TYP_INT)));
+}
+
 /*****************************************************************************
  *
  *  Create a basic block and append it to the current BB list.
@@ -4298,6 +4574,9 @@ void Compiler::fgSwitchToOptimized()
     // Switch to optimized and re-init options
     assert(opts.jitFlags->IsSet(JitFlags::JIT_FLAG_TIER0));
     opts.jitFlags->Clear(JitFlags::JIT_FLAG_TIER0);
+
+    // Tier-0 instrumentation only feeds the tier 1 compilation; optimized code is final.
+    opts.jitFlags->Clear(JitFlags::JIT_FLAG_BBINSTR);
     compInitOptions(opts.jitFlags);
 
     // Notify the VM of the change
@@ -5219,6 +5498,8 @@ void Compiler::fgMarkBackwardJump(BasicBlock* startBlock, BasicBlock* endBlock)
 {
     noway_assert(startBlock->bbNum <= endBlock->bbNum);
 
+    startBlock->bbFlags |= BBF_BACKWARD_JUMP_TARGET;
+
     for (BasicBlock* block = startBlock; block != endBlock->bbNext; block = block->bbNext)
     {
         if ((block->bbFlags & BBF_BACKWARD_JUMP) == 0)
@@ -22556,6 +22837,10 @@ Compiler::fgWalkResult Compiler::fgUpdateInlineReturnExpressionPlaceHolder(GenTr
 //    optimizations may have provided more accurate types than we saw when
 //    first importing the trees.
 //
+//    We also fold reads of a box payload when inlining substituted the box
+//    for an object the inlinee unboxed: the value is read from a local copy
+//    and the box allocation is removed.
+//
 //    It would be nice to screen candidate sites based on the likelihood
 //    that something has changed. Otherwise we'll waste some time retrying
 //    an optimization that will just fail again.
@@ -22631,6 +22916,19 @@ Compiler::fgWalkResult Compiler::fgLateDevirtualization(GenTree** pTree, fgWalkD
             }
         }
     }
+    else if ((tree->OperGet() == GT_ADD) && tree->gtGetOp1()->IsBoxedValue() &&
+             tree->gtGetOp2()->IsIntegralConst(TARGET_POINTER_SIZE) && (parent != nullptr) && parent->OperIsIndir())
+    {
+        // The box is only used to read its payload, so read from a local copy instead.
+        GenTree* localCopy = comp->gtTryRemoveBoxUpstreamEffects(tree->gtGetOp1(), BR_MAKE_LOCAL_COPY);
+
+        if (localCopy != nullptr)
+        {
+            JITDUMP("Folding payload read of box [%06u] into local copy [%06u]\n", dspTreeID(tree->gtGetOp1()),
+                    dspTreeID(localCopy));
+            *pTree = localCopy;
+        }
+    }
 
     return WALK_CONTINUE;
 }
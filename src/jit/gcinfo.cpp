@@ -241,12 +241,22 @@ GCInfo::WriteBarrierForm GCInfo::gcIsWriteBarrierCandidate(GenTree* tgt, GenTree
     /* Ignore any assignments of NULL */
 
     // 'assignVal' can be the constant Null or something else (LclVar, etc..)
-    //  that is known to be null via Value Numbering.
-    if (assignVal->GetVN(VNK_Liberal) == ValueNumStore::VNForNull())
+    //  that is known to be null via Value Numbering. Look through any exception
+    //  set: a value that may throw before producing null still stores null.
+    ValueNum assignValVN = assignVal->GetVN(VNK_Liberal);
+    if ((assignValVN != ValueNumStore::NoVN) && (compiler->vnStore != nullptr))
+    {
+        assignValVN = compiler->vnStore->VNNormalValue(assignValVN);
+    }
+    if (assignValVN == ValueNumStore::VNForNull())
     {
         return WBF_NoBarrier;
     }
 
+    // Note that storing into a freshly allocated object still needs a barrier: the object
+    // may be allocated in the LOH, a GC may promote it before the store in fully interruptible
+    // code, and background GC relies on the barrier for software write watch.
+
     if (assignVal->gtOper == GT_CNS_INT && assignVal->gtIntCon.gtIconVal == 0)
     {
         return WBF_NoBarrier;
@@ -8280,7 +8280,13 @@ var_types Compiler::impImportCall(OPCODE                  opcode,
             bool       explicitTailCall       = (tailCall & PREFIX_TAILCALL_EXPLICIT) != 0;
             const bool isLateDevirtualization = false;
             impDevirtualizeCall(call->AsCall(), &callInfo->hMethod, &callInfo->methodFlags, &callInfo->contextHandle,
-                                &exactContextHnd, isLateDevirtualization, explicitTailCall);
+                                &exactContextHnd, isLateDevirtualization, explicitTailCall, rawILOffset);
+
+            // Instrumented tier-0 code records the classes seen here for the tier 1 jit.
+            if (call->gtCall.IsVirtual() && fgClassProbesEnabled())
+            {
+                fgAddClassProbeSite(call->AsCall(), rawILOffset);
+            }
         }
 
         if (impIsThis(obj))
@@ -15135,6 +15141,27 @@ void Compiler::impImportBlockCode(BasicBlock* block)
                             JITDUMP("\nOptimizing %s (%s) -- type test will succeed\n",
                                     opcode == CEE_UNBOX ? "UNBOX" : "UNBOX.ANY", eeGetClassName(clsHnd));
 
+                            // If the object is a box we just created, unbox from a local copy of the
+                            // boxed value instead, so that the box allocation goes away.
+                            if (op1->IsBoxedValue())
+                            {
+                                GenTree* localCopy = gtTryRemoveBoxUpstreamEffects(op1, BR_MAKE_LOCAL_COPY);
+
+                                if (localCopy != nullptr)
+                                {
+                                    JITDUMP("Unboxing from local copy of the box value [%06u]\n", dspTreeID(localCopy));
+                                    impPushOnStack(localCopy, tiRetVal);
+
+                                    if (opcode == CEE_UNBOX)
+                                    {
+                                        break;
+                                    }
+
+                                    oper = GT_OBJ;
+                                    goto OBJ;
+                                }
+                            }
+
                             // For UNBOX, null check (if necessary), and then leave the box payload byref on the stack.
                             if (opcode == CEE_UNBOX)
                             {
@@ -18225,6 +18252,14 @@ void Compiler::impMakeDiscretionaryInlineObservations(InlineInfo* pInlineInfo, I
     {
         frequency = InlineCallsiteFrequency::LOOP;
     }
+    // With profile data, a call site that runs at least twice as often as the root method
+    // is entered is hot, even if it is not in an obvious loop (e.g. in a loop in an inlinee).
+    else if (pInlineInfo->iciBlock->hasProfileWeight() && impInlineRoot()->fgFirstBB->hasProfileWeight() &&
+             (impInlineRoot()->fgFirstBB->bbWeight > BB_ZERO_WEIGHT) &&
+             (pInlineInfo->iciBlock->bbWeight / 2 >= impInlineRoot()->fgFirstBB->bbWeight))
+    {
+        frequency = InlineCallsiteFrequency::HOT;
+    }
     else if (pInlineInfo->iciBlock->hasProfileWeight() && (pInlineInfo->iciBlock->bbWeight > BB_ZERO_WEIGHT))
     {
         frequency = InlineCallsiteFrequency::WARM;
@@ -18507,6 +18542,8 @@ void Compiler::impCheckCanInline(GenTreeCall*           call,
                 pInfo->guardedClassHandle  = nullptr;
                 pInfo->guardedMethodHandle = nullptr;
                 pInfo->stubAddr            = nullptr;
+                pInfo->likelihood          = 0;
+                pInfo->nextCandidate       = nullptr;
             }
 
             pInfo->methInfo                       = methInfo;
@@ -19478,6 +19515,10 @@ BOOL Compiler::impInlineIsGuaranteedThisDerefBeforeAnySideEffects(GenTree*    ad
 //    Mostly a wrapper for impMarkInlineCandidateHelper that also undoes
 //    guarded devirtualization for virtual calls where the method we'd
 //    devirtualize to cannot be inlined.
+//
+//    When a guarded devirtualization candidate guesses for several classes,
+//    each guess is evaluated in turn, and guesses whose method cannot be
+//    inlined are dropped from the chain.
 
 void Compiler::impMarkInlineCandidate(GenTree*               callNode,
                                       CORINFO_CONTEXT_HANDLE exactContextHnd,
@@ -19486,13 +19527,54 @@ void Compiler::impMarkInlineCandidate(GenTree*               callNode,
 {
     GenTreeCall* call = callNode->AsCall();
 
-    // Do the actual evaluation
-    impMarkInlineCandidateHelper(call, exactContextHnd, exactContextNeedsRuntimeLookup, callInfo);
+    if (!call->IsGuardedDevirtualizationCandidate())
+    {
+        // Do the actual evaluation
+        impMarkInlineCandidateHelper(call, exactContextHnd, exactContextNeedsRuntimeLookup, callInfo);
+        return;
+    }
+
+    InlineCandidateInfo* candidate    = call->gtInlineCandidateInfo;
+    InlineCandidateInfo* firstInlined = nullptr;
+    InlineCandidateInfo* lastInlined  = nullptr;
 
-    // If this call is an inline candidate or is not a guarded devirtualization
-    // candidate, we're done.
-    if (call->IsInlineCandidate() || !call->IsGuardedDevirtualizationCandidate())
+    while (candidate != nullptr)
     {
+        InlineCandidateInfo* nextCandidate = candidate->nextCandidate;
+        candidate->nextCandidate           = nullptr;
+
+        // Do the actual evaluation for this guess
+        call->gtInlineCandidateInfo = candidate;
+        call->gtFlags &= ~GTF_CALL_INLINE_CANDIDATE;
+        impMarkInlineCandidateHelper(call, exactContextHnd, exactContextNeedsRuntimeLookup, callInfo);
+
+        if (call->IsInlineCandidate())
+        {
+            if (lastInlined == nullptr)
+            {
+                firstInlined = candidate;
+            }
+            else
+            {
+                lastInlined->nextCandidate = candidate;
+            }
+
+            lastInlined = candidate;
+        }
+        else if (nextCandidate != nullptr)
+        {
+            JITDUMP("Dropping guess for class %s from call [%06u]: target method can't be inlined\n",
+                    eeGetClassName(candidate->guardedClassHandle), dspTreeID(call));
+        }
+
+        candidate = nextCandidate;
+    }
+
+    // If one of the guesses can be inlined, we're done.
+    if (firstInlined != nullptr)
+    {
+        call->gtInlineCandidateInfo = firstInlined;
+        call->gtFlags |= GTF_CALL_INLINE_CANDIDATE;
         return;
     }
 
@@ -19894,6 +19976,7 @@ bool Compiler::IsMathIntrinsic(GenTree* tree)
 //     exactContextHnd -- [OUT] updated context handle iff call devirtualized
 //     isLateDevirtualization -- if devirtualization is happening after importation
 //     isExplicitTailCalll -- [IN] true if we plan on using an explicit tail call
+//     ilOffset -- IL offset of the call, used to look up class profile data
 //
 // Notes:
 //     Virtual calls in IL will always "invoke" the base class method.
@@ -19928,7 +20011,8 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
                                    CORINFO_CONTEXT_HANDLE* contextHandle,
                                    CORINFO_CONTEXT_HANDLE* exactContextHandle,
                                    bool                    isLateDevirtualization,
-                                   bool                    isExplicitTailCall)
+                                   bool                    isExplicitTailCall,
+                                   IL_OFFSET               ilOffset)
 {
     assert(call != nullptr);
     assert(method != nullptr);
@@ -20104,6 +20188,12 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
             return;
         }
 
+        // Guess for the classes the tier-0 code saw, if any.
+        if (addLikelyClassGuardedDevirtualizationCandidates(call, baseMethod, *contextHandle, ilOffset))
+        {
+            return;
+        }
+
         CORINFO_CLASS_HANDLE uniqueImplementingClass = NO_CLASS_HANDLE;
 
         // info.compCompHnd->getUniqueImplementingClass(objClass);
@@ -20210,6 +20300,13 @@ void Compiler::impDevirtualizeCall(GenTreeCall*            call,
     {
         JITDUMP("    Class not final or exact%s\n", isInterface ? "" : ", and method not final");
 
+        // Observed classes are better guesses than the jit's best class.
+        if (!isLateDevirtualization &&
+            addLikelyClassGuardedDevirtualizationCandidates(call, baseMethod, *contextHandle, ilOffset))
+        {
+            return;
+        }
+
         // Have we enabled guarded devirtualization by guessing the jit's best class?
         bool guessJitBestClass = true;
         INDEBUG(guessJitBestClass = (JitConfig.JitGuardedDevirtualizationGuessBestClass() > 0););
@@ -20628,24 +20725,31 @@ void Compiler::addFatPointerCandidate(GenTreeCall* call)
 // child tree, because and we need to clone all these trees when we clone the call
 // as part of guarded devirtualization, and these IR nodes can't be cloned.
 //
+// A call that is already a candidate gets one more guess, tried after the
+// existing ones.
+//
 // Arguments:
 //    call - potentual guarded devirtialization candidate
 //    methodHandle - method that will be invoked if the class test succeeds
 //    classHandle - class that will be tested for at runtime
 //    methodAttr - attributes of the method
 //    classAttr - attributes of the class
+//    likelihood - percent of calls seen with this class, or 0 for guesses
+//      not based on class profile data
 //
 void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
                                                    CORINFO_METHOD_HANDLE methodHandle,
                                                    CORINFO_CLASS_HANDLE  classHandle,
                                                    unsigned              methodAttr,
-                                                   unsigned              classAttr)
+                                                   unsigned              classAttr,
+                                                   unsigned              likelihood)
 {
     // This transformation only makes sense for virtual calls
     assert(call->IsVirtual());
 
-    // Only mark calls if the feature is enabled.
-    const bool isEnabled = JitConfig.JitEnableGuardedDevirtualization() > 0;
+    // Only mark calls if the feature is enabled. Guesses from class profiles
+    // were already opted into by instrumenting the tier-0 code.
+    const bool isEnabled = (JitConfig.JitEnableGuardedDevirtualization() > 0) || (likelihood > 0);
 
     if (!isEnabled)
     {
@@ -20679,6 +20783,32 @@ void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
         return;
     }
 
+    // Gather some information for later. Note we actually allocate InlineCandidateInfo
+    // here, as the devirtualized half of this call will likely become an inline candidate.
+    InlineCandidateInfo* pInfo = new (this, CMK_Inlining) InlineCandidateInfo;
+
+    pInfo->guardedMethodHandle = methodHandle;
+    pInfo->guardedClassHandle  = classHandle;
+    pInfo->likelihood          = likelihood;
+    pInfo->nextCandidate       = nullptr;
+
+    // If the call already has a guess, chain this one after it.
+    if (call->IsGuardedDevirtualizationCandidate())
+    {
+        JITDUMP("Adding guess for class %s to guarded devirtualization candidate [%06u]\n",
+                eeGetClassName(classHandle), dspTreeID(call));
+
+        InlineCandidateInfo* lastInfo = call->gtInlineCandidateInfo;
+        while (lastInfo->nextCandidate != nullptr)
+        {
+            lastInfo = lastInfo->nextCandidate;
+        }
+
+        pInfo->stubAddr         = lastInfo->stubAddr;
+        lastInfo->nextCandidate = pInfo;
+        return;
+    }
+
     // We're all set, proceed with candidate creation.
     JITDUMP("Marking call [%06u] as guarded devirtualization candidate; will guess for class %s\n", dspTreeID(call),
             eeGetClassName(classHandle));
@@ -20689,13 +20819,6 @@ void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
     SpillRetExprHelper helper(this);
     helper.StoreRetExprResultsInArgs(call);
 
-    // Gather some information for later. Note we actually allocate InlineCandidateInfo
-    // here, as the devirtualized half of this call will likely become an inline candidate.
-    GuardedDevirtualizationCandidateInfo* pInfo = new (this, CMK_Inlining) InlineCandidateInfo;
-
-    pInfo->guardedMethodHandle = methodHandle;
-    pInfo->guardedClassHandle  = classHandle;
-
     // Save off the stub address since it shares a union with the candidate info.
     if (call->IsVirtualStub())
     {
@@ -20709,3 +20832,79 @@ void Compiler::addGuardedDevirtualizationCandidate(GenTreeCall*          call,
 
     call->gtGuardedDevirtualizationCandidateInfo = pInfo;
 }
+
+//------------------------------------------------------------------------
+// addLikelyClassGuardedDevirtualizationCandidates: mark a virtual call as a
+//    guarded devirtualization candidate guessing for the classes seen by
+//    the instrumented tier-0 code
+//
+// Arguments:
+//    call - virtual call
+//    baseMethod - method the call invokes
+//    ownerType - context for resolving the method
+//    ilOffset - IL offset of the call
+//
+// Returns:
+//    true if the call now guesses for at least one class.
+//
+// Notes:
+//    Up to JitGuardedDevirtualizationMaxTypeChecks classes are guessed for,
+//    most likely first, skipping classes seen in fewer than
+//    JitGuardedDevirtualizationMinLikelihood percent of the sampled calls.
+//
+bool Compiler::addLikelyClassGuardedDevirtualizationCandidates(GenTreeCall*           call,
+                                                               CORINFO_METHOD_HANDLE  baseMethod,
+                                                               CORINFO_CONTEXT_HANDLE ownerType,
+                                                               IL_OFFSET              ilOffset)
+{
+    if ((ilOffset == BAD_IL_OFFSET) || (JitConfig.JitClassProfiling() == 0) || !fgHaveProfileData())
+    {
+        return false;
+    }
+
+    LikelyClass    likelyClasses[ICorJitInfo::ClassProfile::SIZE];
+    const unsigned likelyClassCount = fgGetLikelyClasses(ilOffset, likelyClasses, ICorJitInfo::ClassProfile::SIZE);
+    const unsigned maxGuesses       = (unsigned)JitConfig.JitGuardedDevirtualizationMaxTypeChecks();
+    const unsigned minLikelihood    = (unsigned)JitConfig.JitGuardedDevirtualizationMinLikelihood();
+    unsigned       guessCount       = 0;
+
+    for (unsigned i = 0; (i < likelyClassCount) && (guessCount < maxGuesses); i++)
+    {
+        if (likelyClasses[i].likelihood < minLikelihood)
+        {
+            // The rest are even less likely
+            break;
+        }
+
+        CORINFO_CLASS_HANDLE likelyClass   = likelyClasses[i].clsHandle;
+        const DWORD          likelyAttribs = info.compCompHnd->getClassAttribs(likelyClass);
+
+        // Boxed receivers would need the unboxed entry; leave them to the virtual call.
+        if ((likelyAttribs & CORINFO_FLG_VALUECLASS) != 0)
+        {
+            continue;
+        }
+
+        CORINFO_METHOD_HANDLE likelyMethod = info.compCompHnd->resolveVirtualMethod(baseMethod, likelyClass, ownerType);
+
+        if (likelyMethod == nullptr)
+        {
+            JITDUMP("Can't figure out which method %s would invoke, skipping\n", eeGetClassName(likelyClass));
+            continue;
+        }
+
+        const DWORD likelyMethodAttribs = info.compCompHnd->getMethodAttribs(likelyMethod);
+        addGuardedDevirtualizationCandidate(call, likelyMethod, likelyClass, likelyMethodAttribs, likelyAttribs,
+                                            max(likelyClasses[i].likelihood, 1u));
+
+        if (!call->IsGuardedDevirtualizationCandidate())
+        {
+            // Call site was not suitable
+            break;
+        }
+
+        guessCount++;
+    }
+
+    return guessCount > 0;
+}
@@ -65,6 +65,11 @@
 //     subsequent statements
 //   }
 //
+// A guarded devirtualization candidate that guesses for several classes gets one
+// check block and one then block per guess, most likely class first; each check
+// jumps to the next check when its class does not match, and the last one jumps
+// to the else block with the original virtual call.
+//
 class IndirectCallTransformer
 {
 public:
@@ -243,7 +248,7 @@ private:
         //------------------------------------------------------------------------
         // SetWeights: set weights for new blocks.
         //
-        void SetWeights()
+        virtual void SetWeights()
         {
             remainderBlock->inheritWeight(currBlock);
             checkBlock->inheritWeight(currBlock);
@@ -478,7 +483,7 @@ private:
     {
     public:
         GuardedDevirtualizationTransformer(Compiler* compiler, BasicBlock* block, GenTreeStmt* stmt)
-            : Transformer(compiler, block, stmt), returnTemp(BAD_VAR_NUM)
+            : Transformer(compiler, block, stmt), returnTemp(BAD_VAR_NUM), origRetExpr(nullptr), remainingWeight(100)
         {
         }
 
@@ -552,11 +557,23 @@ private:
         }
 
         //------------------------------------------------------------------------
-        // CreateCheck: create check block and check method table
+        // CreateCheck: create check block and check method table for the first guess
         //
         virtual void CreateCheck()
         {
-            checkBlock = CreateAndInsertBasicBlock(BBJ_COND, currBlock);
+            CreateCheck(currBlock, origCall->gtInlineCandidateInfo);
+        }
+
+        //------------------------------------------------------------------------
+        // CreateCheck: create check block and check method table
+        //
+        // Arguments:
+        //    insertAfter - block to put the check block after
+        //    candidate - the guess to check for
+        //
+        void CreateCheck(BasicBlock* insertAfter, InlineCandidateInfo* candidate)
+        {
+            checkBlock = CreateAndInsertBasicBlock(BBJ_COND, insertAfter);
 
             // Fetch method table from object arg to call.
             GenTree* thisTree = compiler->gtCloneExpr(origCall->gtCallObjp);
@@ -581,9 +598,8 @@ private:
             methodTable->gtFlags |= GTF_IND_INVARIANT;
 
             // Find target method table
-            GuardedDevirtualizationCandidateInfo* guardedInfo       = origCall->gtGuardedDevirtualizationCandidateInfo;
-            CORINFO_CLASS_HANDLE                  clsHnd            = guardedInfo->guardedClassHandle;
-            GenTree*                              targetMethodTable = compiler->gtNewIconEmbClsHndNode(clsHnd);
+            CORINFO_CLASS_HANDLE clsHnd            = candidate->guardedClassHandle;
+            GenTree*             targetMethodTable = compiler->gtNewIconEmbClsHndNode(clsHnd);
 
             // Compare and jump to else (which does the indirect call) if NOT equal
             GenTree*     methodTableCompare = compiler->gtNewOperNode(GT_NE, TYP_INT, targetMethodTable, methodTable);
@@ -608,6 +624,7 @@ private:
             // munging for small structs.
             InlineCandidateInfo* inlineInfo = origCall->gtInlineCandidateInfo;
             GenTree*             retExpr    = inlineInfo->retExpr;
+            origRetExpr                     = retExpr;
 
             // Sanity check the ret expr if non-null: it should refer to the original call.
             if (retExpr != nullptr)
@@ -652,14 +669,44 @@ private:
         }
 
         //------------------------------------------------------------------------
-        // CreateThen: create else block with direct call to method
+        // CreateThen: create then blocks with direct calls to the guessed methods,
+        //   and the check blocks for the guesses after the first
         //
         virtual void CreateThen()
+        {
+            InlineCandidateInfo* candidate = origCall->gtInlineCandidateInfo;
+            CreateThen(candidate);
+
+            for (candidate = candidate->nextCandidate; candidate != nullptr; candidate = candidate->nextCandidate)
+            {
+                BasicBlock* prevCheckBlock = checkBlock;
+                thenBlock->bbJumpDest      = remainderBlock;
+
+                CreateCheck(thenBlock, candidate);
+                InheritWeightPercentage(checkBlock, remainingWeight);
+                prevCheckBlock->bbJumpDest = checkBlock;
+
+                CreateThen(candidate);
+            }
+        }
+
+        //------------------------------------------------------------------------
+        // CreateThen: create then block with direct call to method
+        //
+        // Arguments:
+        //    inlineInfo - the guess the block calls the method for
+        //
+        void CreateThen(InlineCandidateInfo* inlineInfo)
         {
             thenBlock = CreateAndInsertBasicBlock(BBJ_ALWAYS, checkBlock);
 
-            InlineCandidateInfo* inlineInfo = origCall->gtInlineCandidateInfo;
-            CORINFO_CLASS_HANDLE clsHnd     = inlineInfo->clsHandle;
+            CORINFO_CLASS_HANDLE clsHnd = inlineInfo->clsHandle;
+
+            // Guesses without profile data are taken to be likely
+            unsigned likelihood = (inlineInfo->likelihood != 0) ? inlineInfo->likelihood : HIGH_PROBABILITY;
+            likelihood          = min(likelihood, remainingWeight);
+            remainingWeight -= likelihood;
+            InheritWeightPercentage(thenBlock, likelihood);
 
             // copy 'this' to temp with exact type.
             const unsigned thisTemp  = compiler->lvaGrabTemp(false DEBUGARG("guarded devirt this exact temp"));
@@ -693,7 +740,7 @@ private:
             assert(!call->IsVirtual());
 
             // Re-establish this call as an inline candidate.
-            GenTree* oldRetExpr         = inlineInfo->retExpr;
+            GenTree* oldRetExpr         = origRetExpr;
             inlineInfo->clsHandle       = clsHnd;
             inlineInfo->exactContextHnd = context;
             call->gtInlineCandidateInfo = inlineInfo;
@@ -766,8 +813,49 @@ private:
             stmt->gtStmtExpr = compiler->gtNewNothingNode();
         }
 
+        //------------------------------------------------------------------------
+        // SetWeights: set weights for the blocks not weighted as they were created.
+        //
+        virtual void SetWeights()
+        {
+            remainderBlock->inheritWeight(currBlock);
+            InheritWeightPercentage(elseBlock, remainingWeight);
+
+            // The first check always runs
+            BasicBlock* firstCheckBlock = currBlock->bbNext;
+            assert(firstCheckBlock->bbJumpKind == BBJ_COND);
+            firstCheckBlock->inheritWeight(currBlock);
+        }
+
     private:
+        //------------------------------------------------------------------------
+        // InheritWeightPercentage: give a block a percentage of currBlock's weight
+        //
+        // Arguments:
+        //    block - block to set the weight of
+        //    percentage - 0 to 100
+        //
+        // Notes:
+        //    A guess can have all the remaining weight (e.g. the only class seen),
+        //    which inheritWeightPercentage doesn't take.
+        //
+        void InheritWeightPercentage(BasicBlock* block, unsigned percentage)
+        {
+            assert(percentage <= 100);
+
+            if (percentage == 100)
+            {
+                block->inheritWeight(currBlock);
+            }
+            else
+            {
+                block->inheritWeightPercentage(currBlock, percentage);
+            }
+        }
+
         unsigned returnTemp;
+        GenTree* origRetExpr;
+        unsigned remainingWeight;
     };
 
     Compiler* compiler;
@@ -505,14 +505,21 @@ private:
     bool                  m_Reported;
 };
 
+struct InlineCandidateInfo;
+
 // GuardedDevirtualizationCandidateInfo provides information about
 // a potential target of a virtual call.
+//
+// A call may guess for several classes, most likely first; the
+// guesses after the first are chained through nextCandidate.
 
 struct GuardedDevirtualizationCandidateInfo
 {
     CORINFO_CLASS_HANDLE  guardedClassHandle;
     CORINFO_METHOD_HANDLE guardedMethodHandle;
     void*                 stubAddr;
+    unsigned              likelihood; // percent of calls expected to match, 0 if unknown
+    InlineCandidateInfo*  nextCandidate;
 };
 
 // InlineCandidateInfo provides basic information about a particular
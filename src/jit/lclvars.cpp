@@ -1611,12 +1611,6 @@ void Compiler::StructPromotionHelper::CheckRetypedAsScalar(CORINFO_FIELD_HANDLE
 //
 bool Compiler::StructPromotionHelper::CanPromoteStructType(CORINFO_CLASS_HANDLE typeHnd)
 {
-    if (!compiler->eeIsValueClass(typeHnd))
-    {
-        // TODO-ObjectStackAllocation: Enable promotion of fields of stack-allocated objects.
-        return false;
-    }
-
     if (structPromotionInfo.typeHnd == typeHnd)
     {
         // Asking for the same type of struct as the last time.
@@ -1634,8 +1628,8 @@ bool Compiler::StructPromotionHelper::CanPromoteStructType(CORINFO_CLASS_HANDLE
     CLANG_FORMAT_COMMENT_ANCHOR;
 #if defined(FEATURE_SIMD)
 #if defined(_TARGET_XARCH_)
-    // This will allow promotion of 4 Vector<T> fields on AVX2 or Vector256<T> on AVX,
-    // or 8 Vector<T>/Vector128<T> fields on SSE2.
+    // This will allow promotion of up to MAX_NumOfFieldsInPromotableStruct Vector<T> fields
+    // on AVX2 or Vector256<T> fields on AVX.
     const int MaxOffset = MAX_NumOfFieldsInPromotableStruct * YMM_REGSIZE_BYTES;
 #elif defined(_TARGET_ARM64_)
     const int MaxOffset = MAX_NumOfFieldsInPromotableStruct * FP_REGSIZE_BYTES;
@@ -1652,14 +1646,35 @@ bool Compiler::StructPromotionHelper::CanPromoteStructType(CORINFO_CLASS_HANDLE
 
     COMP_HANDLE compHandle = compiler->info.compCompHnd;
 
-    unsigned structSize = compHandle->getClassSize(typeHnd);
+    // The only struct locals with a reference class handle are stack-allocated objects.
+    // Their layout starts with the method table pointer, which we promote as an extra
+    // TYP_I_IMPL field, followed by the instance fields of the class.
+    const bool isStackAllocatedObject = !compiler->eeIsValueClass(typeHnd);
+    unsigned   firstFieldOrdinal      = 0;
+
+    if (isStackAllocatedObject)
+    {
+        // getFieldInClass only enumerates the fields introduced by the class itself,
+        // so don't promote objects that inherit instance fields.
+        CORINFO_CLASS_HANDLE parentHnd = compHandle->getParentType(typeHnd);
+        if ((parentHnd == nullptr) || (compHandle->getClassNumInstanceFields(parentHnd) != 0))
+        {
+            return false;
+        }
+
+        firstFieldOrdinal = 1;
+    }
+
+    unsigned structSize =
+        isStackAllocatedObject ? compHandle->getHeapClassSize(typeHnd) : compHandle->getClassSize(typeHnd);
     if (structSize > MaxOffset)
     {
         return false; // struct is too large
     }
 
-    unsigned fieldCnt = compHandle->getClassNumInstanceFields(typeHnd);
-    if (fieldCnt == 0 || fieldCnt > MAX_NumOfFieldsInPromotableStruct)
+    unsigned classFieldCnt = compHandle->getClassNumInstanceFields(typeHnd);
+    unsigned fieldCnt      = classFieldCnt + firstFieldOrdinal;
+    if (classFieldCnt == 0 || fieldCnt > MAX_NumOfFieldsInPromotableStruct)
     {
         return false; // struct must have between 1 and MAX_NumOfFieldsInPromotableStruct fields
     }
@@ -1686,9 +1701,21 @@ bool Compiler::StructPromotionHelper::CanPromoteStructType(CORINFO_CLASS_HANDLE
 
     unsigned fieldsSize = 0;
 
-    for (BYTE ordinal = 0; ordinal < fieldCnt; ++ordinal)
+    if (isStackAllocatedObject)
     {
-        CORINFO_FIELD_HANDLE fieldHnd       = compHandle->getFieldInClass(typeHnd, ordinal);
+        // The method table pointer has no field handle; it is only ever accessed
+        // by offset (see ObjectAllocator::MorphAllocObjNodeIntoStackAlloc).
+        lvaStructFieldInfo& methodTableInfo = structPromotionInfo.fields[0];
+        methodTableInfo.fldOffset           = 0;
+        methodTableInfo.fldOrdinal          = 0;
+        methodTableInfo.fldType             = TYP_I_IMPL;
+        methodTableInfo.fldSize             = TARGET_POINTER_SIZE;
+        fieldsSize += TARGET_POINTER_SIZE;
+    }
+
+    for (BYTE ordinal = (BYTE)firstFieldOrdinal; ordinal < fieldCnt; ++ordinal)
+    {
+        CORINFO_FIELD_HANDLE fieldHnd       = compHandle->getFieldInClass(typeHnd, ordinal - firstFieldOrdinal);
         structPromotionInfo.fields[ordinal] = GetFieldInfo(fieldHnd, ordinal);
         const lvaStructFieldInfo& fieldInfo = structPromotionInfo.fields[ordinal];
 
@@ -1880,6 +1907,14 @@ bool Compiler::StructPromotionHelper::ShouldPromoteStructVar(unsigned lclNum)
                 structPromotionInfo.fieldCnt, varDsc->lvFieldAccessed);
         shouldPromote = false;
     }
+    // Wider structs are also copied field by field once promoted. If they have holes
+    // the field-wise copy does no less work than the block copy, so leave them alone.
+    else if ((structPromotionInfo.fieldCnt > 4) && structPromotionInfo.containsHoles)
+    {
+        JITDUMP("Not promoting promotable struct local V%02u: #fields = %d and the struct has holes.\n", lclNum,
+                structPromotionInfo.fieldCnt);
+        shouldPromote = false;
+    }
 #if defined(_TARGET_AMD64_) || defined(_TARGET_ARM64_) || defined(_TARGET_ARM_)
     // TODO-PERF - Only do this when the LclVar is used in an argument context
     // TODO-ARM64 - HFA support should also eliminate the need for this.
@@ -2151,7 +2186,8 @@ void Compiler::StructPromotionHelper::PromoteStructVar(unsigned lclNum)
 #ifdef DEBUG
         char buf[200];
         sprintf_s(buf, sizeof(buf), "%s V%02u.%s (fldOffset=0x%x)", "field", lclNum,
-                  compiler->eeGetFieldName(pFieldInfo->fldHnd), pFieldInfo->fldOffset);
+                  (pFieldInfo->fldHnd != nullptr) ? compiler->eeGetFieldName(pFieldInfo->fldHnd) : "<MethodTable>",
+                  pFieldInfo->fldOffset);
 
         // We need to copy 'buf' as lvaGrabTemp() below caches a copy to its argument.
         size_t len  = strlen(buf) + 1;
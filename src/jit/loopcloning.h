@@ -220,6 +220,23 @@ struct LcJaggedArrayOptInfo : public LcOptInfo
     }
 };
 
+/**
+ *
+ * Optimization info for a span (or any other bounds check against a length held in a local).
+ */
+struct LcSpanOptInfo : public LcOptInfo
+{
+    unsigned     lenLcl;   // Local holding the length the index is checked against.
+    GenTree*     bndsChk;  // "bndsChk" is the GT_COMMA whose first operand is the bounds check.
+    BasicBlock*  useBlock; // Block where the bounds check occurs.
+    GenTreeStmt* stmt;     // "stmt" where the optimization opportunity occurs.
+
+    LcSpanOptInfo(unsigned lenLcl, GenTree* bndsChk, BasicBlock* useBlock, GenTreeStmt* stmt)
+        : LcOptInfo(this, LcSpan), lenLcl(lenLcl), bndsChk(bndsChk), useBlock(useBlock), stmt(stmt)
+    {
+    }
+};
+
 /**
  *
  * Symbolic representation of a.length, or a[i][j].length or a[i,j].length and so on.
@@ -816,10 +816,16 @@ GenTree* Lowering::LowerSwitch(GenTree* node)
 //    than the traditional jump table base code. And of course, it also avoids the need
 //    to emit the jump table itself that can reach up to 256 bytes (for 64 entries).
 //
+//    ARM64 has no BT instruction so the bit is extracted with a shift and tested with
+//    AND(..., 1), which LowerJTrue turns into a TBZ/TBNZ:
+//        mov  w1, #245
+//        lsr  w1, w1, w0
+//        tbnz w1, #0, target1
+//
 bool Lowering::TryLowerSwitchToBitTest(
     BasicBlock* jumpTable[], unsigned jumpCount, unsigned targetCount, BasicBlock* bbSwitch, GenTree* switchValue)
 {
-#ifndef _TARGET_XARCH_
+#if !defined(_TARGET_XARCH_) && !defined(_TARGET_ARM64_)
     // Other architectures may use this if they substitute GT_BT with equivalent code.
     return false;
 #else
@@ -945,15 +951,34 @@ bool Lowering::TryLowerSwitchToBitTest(
 
     var_types bitTableType = (bitCount <= (genTypeSize(TYP_INT) * 8)) ? TYP_INT : TYP_LONG;
     GenTree*  bitTableIcon = comp->gtNewIconNode(bitTable, bitTableType);
-    GenTree*  bitTest      = comp->gtNewOperNode(GT_BT, TYP_VOID, bitTableIcon, switchValue);
+
+#ifdef _TARGET_XARCH_
+    GenTree* bitTest = comp->gtNewOperNode(GT_BT, TYP_VOID, bitTableIcon, switchValue);
     bitTest->gtFlags |= GTF_SET_FLAGS;
     GenTreeCC* jcc = new (comp, GT_JCC) GenTreeCC(GT_JCC, bbSwitchCondition);
     jcc->gtFlags |= GTF_USE_FLAGS;
 
     LIR::AsRange(bbSwitch).InsertAfter(switchValue, bitTableIcon, bitTest, jcc);
+#else  // _TARGET_ARM64_
+    //
+    // Append JTRUE(NE/EQ(AND(RSZ(bitTable, switchValue), 1), 0)) to the switch block. The switch block
+    // has not been lowered yet so these nodes will be lowered (and the JTRUE turned into a JCMP) later.
+    //
+
+    GenTree*   shift    = comp->gtNewOperNode(GT_RSZ, bitTableType, bitTableIcon, switchValue);
+    GenTree*   one      = comp->gtNewIconNode(1, bitTableType);
+    GenTree*   bit      = comp->gtNewOperNode(GT_AND, bitTableType, shift, one);
+    GenTree*   zero     = comp->gtNewIconNode(0, bitTableType);
+    genTreeOps cmpOper  = (bbSwitchCondition == GenCondition::C) ? GT_NE : GT_EQ;
+    GenTree*   cmp      = comp->gtNewOperNode(cmpOper, TYP_INT, bit, zero);
+    GenTree*   jumpTrue = comp->gtNewOperNode(GT_JTRUE, TYP_VOID, cmp);
+
+    LIR::AsRange(bbSwitch).InsertAfter(switchValue, bitTableIcon, shift, one);
+    LIR::AsRange(bbSwitch).InsertAfter(one, bit, zero, cmp, jumpTrue);
+#endif // _TARGET_ARM64_
 
     return true;
-#endif // _TARGET_XARCH_
+#endif // _TARGET_XARCH_ || _TARGET_ARM64_
 }
 
 // NOTE: this method deliberately does not update the call arg table. It must only
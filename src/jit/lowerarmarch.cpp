@@ -830,7 +830,23 @@ void Lowering::ContainCheckSIMD(GenTreeSIMD* simdNode)
 
         case SIMDIntrinsicOpEquality:
         case SIMDIntrinsicOpInEquality:
-            // TODO-ARM64-CQ Support containing 0
+        case SIMDIntrinsicEqual:
+            // Comparisons against a zero vector can use the "cmeq Vd, Vn, #0" form.
+            op2 = simdNode->gtGetOp2();
+            if (op2->IsIntegralConstVector(0))
+            {
+                MakeSrcContained(simdNode, op2);
+            }
+            break;
+
+        case SIMDIntrinsicGreaterThan:
+        case SIMDIntrinsicGreaterThanOrEqual:
+            // cmgt and cmge also have a compare-with-zero form, but the unsigned cmhi and cmhs do not.
+            op2 = simdNode->gtGetOp2();
+            if (op2->IsIntegralConstVector(0) && !varTypeIsUnsigned(simdNode->gtSIMDBaseType))
+            {
+                MakeSrcContained(simdNode, op2);
+            }
             break;
 
         case SIMDIntrinsicGetItem:
@@ -432,6 +432,9 @@ inline bool RefTypeIsDef(RefType refType)
 
 typedef regNumberSmall* VarToRegMap;
 
+// Intervals and RefPositions are allocated from the compiler's arena in creation order, so in practice the list
+// nodes are laid out nearly contiguously. RefPositions are also referenced by pointer (nextRefPosition,
+// recentRefPosition, etc.), so they must not move once created, which rules out a growable array.
 typedef jitstd::list<Interval>                      IntervalList;
 typedef jitstd::list<RefPosition>                   RefPositionList;
 typedef jitstd::list<RefPosition>::iterator         RefPositionIterator;
@@ -1147,13 +1147,15 @@ bool LinearScan::buildKillPositionsForNode(GenTree* tree, LsraLocation currentLo
 
         addRefsForPhysRegMask(killMask, currentLoc, RefTypeKill, true);
 
-        // TODO-CQ: It appears to be valuable for both fp and int registers to avoid killing the callee
-        // save regs on infrequently executed paths.  However, it results in a large number of asmDiffs,
-        // many of which appear to be regressions (because there is more spill on the infrequently path),
-        // but are not really because the frequent path becomes smaller.  Validating these diffs will need
-        // to be done before making this change.
-        // if (!blockSequence[curBBSeqNum]->isRunRarely())
-        if (enregisterLocalVars)
+        // It is valuable for both fp and int registers to avoid killing the callee save regs on
+        // infrequently executed paths: the live vars then keep the registers that suit the frequent
+        // path, and get spilled and reloaded (through resolution at the block boundaries) around the
+        // rare call. This shows up as more spill on the infrequent path, but the frequent path
+        // becomes smaller. Opt-in with COMPlus_JitLsraIgnoreRareCallKills=1 for now.
+        const bool isRareKill =
+            (JitConfig.JitLsraIgnoreRareCallKills() != 0) && blockSequence[curBBSeqNum]->isRunRarely();
+
+        if (enregisterLocalVars && !isRareKill)
         {
             VarSetOps::Iter iter(compiler, currentLiveVars);
             unsigned        varIndex = 0;
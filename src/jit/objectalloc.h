@@ -122,7 +122,8 @@ inline void ObjectAllocator::EnableObjectStackAllocation()
 //    Returns true iff local variable can be allocated on the stack.
 //
 // Notes:
-//    Stack allocation of objects with gc fields and boxed objects is currently disabled.
+//    Stack allocation of boxed objects is currently disabled. Objects with gc fields
+//    are allowed: the stack local gets the class gc layout and the fields may be promoted.
 
 inline bool ObjectAllocator::CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd)
 {
@@ -2730,6 +2730,13 @@ bool Compiler::optIsCSEcandidate(GenTree* tree)
         case GT_INTRINSIC:
             return true; // Intrinsics
 
+#ifdef FEATURE_HW_INTRINSICS
+        case GT_HWIntrinsic:
+            // Only intrinsics that don't access memory are pure functions of their operands
+            // (see fgValueNumberHWIntrinsic).
+            return !tree->AsHWIntrinsic()->OperIsMemoryLoadOrStore();
+#endif // FEATURE_HW_INTRINSICS
+
         case GT_COMMA:
             return true; // Allow GT_COMMA nodes to be CSE-ed.
 
@@ -4666,6 +4666,14 @@ bool Compiler::optDeriveLoopCloningConditions(unsigned loopNum, LoopCloneContext
                     context->EnsureConditions(loopNum)->Push(cond);
                 }
                 break;
+                case LcOptInfo::LcSpan:
+                {
+                    // limit <= spanLen
+                    LcSpanOptInfo* spanInfo = optInfo->AsLcSpanOptInfo();
+                    LC_Condition   cond(GT_LE, LC_Expr(ident), LC_Expr(LC_Ident(spanInfo->lenLcl, LC_Ident::Var)));
+                    context->EnsureConditions(loopNum)->Push(cond);
+                }
+                break;
 
                 default:
                     JITDUMP("Unknown opt\n");
@@ -4936,12 +4944,199 @@ void Compiler::optPerformStaticOptimizations(unsigned loopNum, LoopCloneContext*
             case LcOptInfo::LcMdArray:
                 // TODO-CQ: CLONE: Implement.
                 break;
+            case LcOptInfo::LcSpan:
+            {
+                LcSpanOptInfo* spanInfo = optInfo->AsLcSpanOptInfo();
+                compCurBB               = spanInfo->useBlock;
+                optRemoveRangeCheck(spanInfo->bndsChk, spanInfo->stmt);
+                DBEXEC(dynamicPath, optDebugLogLoopCloning(spanInfo->useBlock, spanInfo->stmt));
+            }
+            break;
             default:
                 break;
         }
     }
 }
 
+#ifdef DEBUG
+
+// Tree walk state for optIsVectorizableLoop.
+struct VectorizableLoopVisitorInfo
+{
+    unsigned iterVar;
+    unsigned arrayAccesses;
+    unsigned arrayStores;
+    unsigned reductions;
+    bool     rejected;
+};
+
+//----------------------------------------------------------------------------
+//  optVectorizableLoopTreeVisitor: Classify one tree of a vectorization candidate loop.
+//
+//  Notes:
+//      Rejects trees with calls, stores to memory other than array elements, and
+//      array elements that are not of a primitive, non-GC type. Counts array element
+//      accesses and "x = x op y" reductions on locals.
+//
+/* static */
+Compiler::fgWalkResult Compiler::optVectorizableLoopTreeVisitor(GenTree** pTree, fgWalkData* data)
+{
+    GenTree*                     tree = *pTree;
+    VectorizableLoopVisitorInfo* info = (VectorizableLoopVisitorInfo*)data->pCallbackData;
+
+    if (tree->IsCall())
+    {
+        info->rejected = true;
+        return WALK_ABORT;
+    }
+
+    if ((tree->OperGet() == GT_IND) && ((tree->gtFlags & GTF_IND_ARR_INDEX) != 0))
+    {
+        if (!varTypeIsArithmetic(tree->TypeGet()))
+        {
+            info->rejected = true;
+            return WALK_ABORT;
+        }
+
+        info->arrayAccesses++;
+    }
+    else if (tree->OperGet() == GT_ASG)
+    {
+        GenTree* dst = tree->gtGetOp1();
+        GenTree* src = tree->gtGetOp2();
+
+        if ((dst->OperGet() == GT_IND) && ((dst->gtFlags & GTF_IND_ARR_INDEX) != 0))
+        {
+            info->arrayStores++;
+        }
+        else if (dst->OperGet() == GT_LCL_VAR)
+        {
+            unsigned lclNum = dst->gtLclVarCommon.gtLclNum;
+
+            if ((lclNum != info->iterVar) && src->OperIs(GT_ADD, GT_OR, GT_AND, GT_XOR) &&
+                src->gtGetOp1()->OperIs(GT_LCL_VAR) && (src->gtGetOp1()->gtLclVarCommon.gtLclNum == lclNum))
+            {
+                info->reductions++;
+            }
+        }
+        else
+        {
+            // A store the vectorizer can't reason about; it may alias the arrays.
+            info->rejected = true;
+            return WALK_ABORT;
+        }
+    }
+
+    return WALK_CONTINUE;
+}
+
+//----------------------------------------------------------------------------
+//  optIsVectorizableLoop: Check if a loop has the shape of an element-wise
+//      or reduction loop over arrays.
+//
+//  Arguments:
+//      loopNum     the loop to check.
+//
+//  Return Value:
+//      true if the loop is a single-block counted loop, stepping by one up to a
+//      limit, whose body only accesses primitive array elements and locals.
+//
+bool Compiler::optIsVectorizableLoop(unsigned loopNum)
+{
+    LoopDsc* loop = &optLoopTable[loopNum];
+
+    if ((loop->lpFlags & (LPFLG_REMOVED | LPFLG_ITER)) != LPFLG_ITER)
+    {
+        return false;
+    }
+
+    if ((loop->lpTop != loop->lpBottom) || (loop->lpBottom->bbJumpKind != BBJ_COND))
+    {
+        JITDUMP("Vectorization: L%02u is not a single block loop\n", loopNum);
+        return false;
+    }
+
+    if ((loop->lpIterOper() != GT_ADD) || (loop->lpIterConst() != 1) || (loop->lpTestOper() != GT_LT))
+    {
+        JITDUMP("Vectorization: L%02u does not step by one up to a limit\n", loopNum);
+        return false;
+    }
+
+    if ((loop->lpFlags & (LPFLG_CONST_LIMIT | LPFLG_VAR_LIMIT | LPFLG_ARRLEN_LIMIT)) == 0)
+    {
+        JITDUMP("Vectorization: L%02u has an unknown limit\n", loopNum);
+        return false;
+    }
+
+    VectorizableLoopVisitorInfo info;
+    info.iterVar       = loop->lpIterVar();
+    info.arrayAccesses = 0;
+    info.arrayStores   = 0;
+    info.reductions    = 0;
+    info.rejected      = false;
+
+    BasicBlock* block = loop->lpTop;
+    for (GenTreeStmt* stmt = block->firstStmt(); stmt != nullptr; stmt = stmt->getNextStmt())
+    {
+        if (stmt->gtStmtExpr == loop->lpIterTree)
+        {
+            continue;
+        }
+
+        fgWalkTreePre(&stmt->gtStmtExpr, optVectorizableLoopTreeVisitor, &info);
+
+        if (info.rejected)
+        {
+            JITDUMP("Vectorization: L%02u has a call or an unrecognized store in [%06u]\n", loopNum,
+                    dspTreeID(stmt->gtStmtExpr));
+            return false;
+        }
+    }
+
+    if ((info.arrayStores == 0) && (info.reductions == 0))
+    {
+        JITDUMP("Vectorization: L%02u neither stores array elements nor reduces\n", loopNum);
+        return false;
+    }
+
+    JITDUMP("Vectorization: L%02u is a candidate: %u array loads, %u array stores, %u reductions\n", loopNum,
+            info.arrayAccesses - info.arrayStores, info.arrayStores, info.reductions);
+    return true;
+}
+
+//----------------------------------------------------------------------------
+//  optFindVectorizableLoops: Identify loops that an auto-vectorizer could
+//      transform, when enabled by COMPlus_JitAutoVectorize (debug builds only).
+//
+//  Notes:
+//      This is the analysis half of auto-vectorization; candidate loops are only
+//      reported in the jit dump. The transformation has to version the loop on the aliasing of
+//      the arrays involved (much like loop cloning) and emit the vector body and
+//      a scalar remainder loop through the hardware intrinsic nodes.
+//
+void Compiler::optFindVectorizableLoops()
+{
+    if ((JitConfig.JitAutoVectorize() == 0) || !opts.OptimizationEnabled())
+    {
+        return;
+    }
+
+    JITDUMP("\n*************** In optFindVectorizableLoops()\n");
+
+    unsigned candidates = 0;
+    for (unsigned loopNum = 0; loopNum < optLoopCount; loopNum++)
+    {
+        if (optIsVectorizableLoop(loopNum))
+        {
+            candidates++;
+        }
+    }
+
+    JITDUMP("Found %u vectorization candidate loop(s)\n", candidates);
+}
+
+#endif // DEBUG
+
 //----------------------------------------------------------------------------
 //  optCanCloneLoops: Use the environment flag to determine whether loop
 //      cloning is allowed to be performed.
@@ -6631,30 +6826,35 @@ void Compiler::optHoistThisLoop(unsigned lnum, LoopHoistContext* hoistCtxt)
     // Find the set of definitely-executed blocks.
     // Ideally, the definitely-executed blocks are the ones that post-dominate the entry block.
     // Until we have post-dominators, we'll special-case for single-exit blocks.
+    //
+    // For loops with more than one exit we use the dominators of the bottom block instead:
+    // they run on every iteration that takes the back edge, but may be skipped by an early
+    // exit in the last iteration. That is fine since only the entry block may hoist trees
+    // that can throw (see optHoistLoopExprsForTree).
     JitExpandArrayStack<BasicBlock*> defExec(getAllocatorLoopHoist());
+    BasicBlock*                      cur = nullptr;
     if (pLoopDsc->lpFlags & LPFLG_ONE_EXIT)
     {
         assert(pLoopDsc->lpExit != nullptr);
-        BasicBlock* cur = pLoopDsc->lpExit;
-        // Push dominators, until we reach "entry" or exit the loop.
-        while (cur != nullptr && pLoopDsc->lpContains(cur) && cur != pLoopDsc->lpEntry)
-        {
-            defExec.Push(cur);
-            cur = cur->bbIDom;
-        }
-        // If we didn't reach the entry block, give up and *just* push the entry block.
-        if (cur != pLoopDsc->lpEntry)
-        {
-            defExec.Reset();
-        }
-        defExec.Push(pLoopDsc->lpEntry);
+        cur = pLoopDsc->lpExit;
     }
     else // More than one exit
     {
-        // We'll assume that only the entry block is definitely executed.
-        // We could in the future do better.
-        defExec.Push(pLoopDsc->lpEntry);
+        cur = pLoopDsc->lpBottom;
+    }
+
+    // Push dominators, until we reach "entry" or exit the loop.
+    while (cur != nullptr && pLoopDsc->lpContains(cur) && cur != pLoopDsc->lpEntry)
+    {
+        defExec.Push(cur);
+        cur = cur->bbIDom;
     }
+    // If we didn't reach the entry block, give up and *just* push the entry block.
+    if (cur != pLoopDsc->lpEntry)
+    {
+        defExec.Reset();
+    }
+    defExec.Push(pLoopDsc->lpEntry);
 
     while (defExec.Size() > 0)
     {
@@ -8454,6 +8654,30 @@ Compiler::fgWalkResult Compiler::optCanOptimizeByLoopCloning(GenTree* tree, Loop
         // TODO-CQ: CLONE: Implement.
         return WALK_SKIP_SUBTREES;
     }
+    else if ((tree->gtOper == GT_COMMA) && (tree->gtGetOp1()->gtOper == GT_ARR_BOUNDS_CHECK))
+    {
+        // Span indexing checks the index against a length local (usually the promoted
+        // length field of the span) rather than against an array length.
+        GenTreeBoundsChk* bndsChk = tree->gtGetOp1()->AsBoundsChk();
+        GenTree*          index   = bndsChk->gtIndex;
+        GenTree*          len     = bndsChk->gtArrLen;
+
+        if ((index->gtOper == GT_LCL_VAR) &&
+            (index->gtLclVarCommon.gtLclNum == optLoopTable[info->loopNum].lpIterVar()) &&
+            (len->gtOper == GT_LCL_VAR) && (len->TypeGet() == TYP_INT))
+        {
+            unsigned lenLcl = len->gtLclVarCommon.gtLclNum;
+
+            if (optIsStackLocalInvariant(info->loopNum, lenLcl))
+            {
+                JITDUMP("Loop %d can be cloned for span bounds check [%06u] against V%02u\n", info->loopNum,
+                        dspTreeID(bndsChk), lenLcl);
+
+                info->context->EnsureLoopOptInfo(info->loopNum)
+                    ->Push(new (this, CMK_LoopOpt) LcSpanOptInfo(lenLcl, tree, compCurBB, info->stmt));
+            }
+        }
+    }
     return WALK_CONTINUE;
 }
 
@@ -267,6 +267,8 @@ typedef unsigned char   regNumberSmall;
   #define FEATURE_EH               1       // To aid platform bring-up, eliminate exceptional EH clauses (catch, filter,
                                            // filter-handler, fault) and directly execute 'finally' clauses.
 
+// Windows x86 keeps the shadow-stack EH model because the VM's x86 exception dispatch (excepx86.cpp) is built on
+// the OS SEH chain; flipping this also requires switching that side to WIN64EXCEPTIONS, as Unix x86 does.
 #if defined(FEATURE_PAL)
   #define FEATURE_EH_FUNCLETS      1
 #else  // !FEATURE_PAL
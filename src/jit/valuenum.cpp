@@ -6851,19 +6851,7 @@ void Compiler::fgValueNumberTree(GenTree* tree)
 #ifdef FEATURE_HW_INTRINSICS
     if (oper == GT_HWIntrinsic)
     {
-        // TODO-CQ: For now hardware intrinsics are not handled by value numbering to be amenable for CSE'ing.
-        tree->gtVNPair.SetBoth(vnStore->VNForExpr(compCurBB, TYP_UNKNOWN));
-
-        GenTreeHWIntrinsic* hwIntrinsicNode = tree->AsHWIntrinsic();
-        assert(hwIntrinsicNode != nullptr);
-
-        // For safety/correctness we must mutate the global heap valuenumber
-        //  for any HW intrinsic that performs a memory store operation
-        if (hwIntrinsicNode->OperIsMemoryStore())
-        {
-            fgMutateGcHeap(tree DEBUGARG("HWIntrinsic - MemoryStore"));
-        }
-
+        fgValueNumberHWIntrinsic(tree);
         return;
     }
 #endif // FEATURE_HW_INTRINSICS
@@ -8427,6 +8415,77 @@ void Compiler::fgValueNumberIntrinsic(GenTree* tree)
     }
 }
 
+#ifdef FEATURE_HW_INTRINSICS
+//------------------------------------------------------------------------
+// fgValueNumberHWIntrinsic: Value number a GT_HWIntrinsic tree.
+//
+// Arguments:
+//    tree - the GT_HWIntrinsic node
+//
+// Notes:
+//    Intrinsics that neither read nor write memory and have at most two
+//    (non list) operands are pure functions of their operands and get a
+//    VNF_HWIntrinsicN value number, which makes them available to CSE and
+//    loop hoisting. Everything else gets a unique value number.
+//
+void Compiler::fgValueNumberHWIntrinsic(GenTree* tree)
+{
+    GenTreeHWIntrinsic* hwIntrinsicNode = tree->AsHWIntrinsic();
+    assert(hwIntrinsicNode != nullptr);
+
+    // For safety/correctness we must mutate the global heap valuenumber
+    //  for any HW intrinsic that performs a memory store operation
+    if (hwIntrinsicNode->OperIsMemoryStore())
+    {
+        fgMutateGcHeap(tree DEBUGARG("HWIntrinsic - MemoryStore"));
+    }
+
+    GenTree* op1 = hwIntrinsicNode->gtGetOp1();
+    GenTree* op2 = hwIntrinsicNode->gtGetOp2();
+
+    if (hwIntrinsicNode->OperIsMemoryLoadOrStore() || hwIntrinsicNode->TypeGet() == TYP_VOID ||
+        ((op1 != nullptr) && op1->OperIsList()) || (hwIntrinsicNode->gtHWIntrinsicId >= 0x8000))
+    {
+        tree->gtVNPair.SetBoth(vnStore->VNForExpr(compCurBB, TYP_UNKNOWN));
+        return;
+    }
+
+    // The memoization for VNFunc applications does not factor in the result type,
+    // so encode it into the first argument along with the intrinsic id and base type.
+    int encoding = ((int)hwIntrinsicNode->gtHWIntrinsicId << 16) | ((int)hwIntrinsicNode->gtSIMDBaseType << 8) |
+                   (int)hwIntrinsicNode->TypeGet();
+    ValueNumPair encodingVNP = ValueNumPair(vnStore->VNForIntCon(encoding), vnStore->VNForIntCon(encoding));
+
+    if (op1 == nullptr)
+    {
+        assert(op2 == nullptr);
+        tree->gtVNPair = vnStore->VNPairForFunc(tree->TypeGet(), VNF_HWIntrinsic0, encodingVNP);
+        return;
+    }
+
+    ValueNumPair op1VNP;
+    ValueNumPair op1VNPx = ValueNumStore::VNPForEmptyExcSet();
+    vnStore->VNPUnpackExc(op1->gtVNPair, &op1VNP, &op1VNPx);
+
+    if (op2 == nullptr)
+    {
+        tree->gtVNPair =
+            vnStore->VNPWithExc(vnStore->VNPairForFunc(tree->TypeGet(), VNF_HWIntrinsic1, encodingVNP, op1VNP),
+                                op1VNPx);
+        return;
+    }
+
+    ValueNumPair op2VNP;
+    ValueNumPair op2VNPx = ValueNumStore::VNPForEmptyExcSet();
+    vnStore->VNPUnpackExc(op2->gtVNPair, &op2VNP, &op2VNPx);
+
+    ValueNumPair excSet = vnStore->VNPExcSetUnion(op1VNPx, op2VNPx);
+    tree->gtVNPair =
+        vnStore->VNPWithExc(vnStore->VNPairForFunc(tree->TypeGet(), VNF_HWIntrinsic2, encodingVNP, op1VNP, op2VNP),
+                            excSet);
+}
+#endif // FEATURE_HW_INTRINSICS
+
 void Compiler::fgValueNumberCastTree(GenTree* tree)
 {
     assert(tree->OperGet() == GT_CAST);
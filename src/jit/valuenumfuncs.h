@@ -159,6 +159,14 @@ ValueNumFuncDef(ADD_UN_OVF, 2, true, false, false)  // unsigned overflow checkin
 ValueNumFuncDef(SUB_UN_OVF, 2, false, false, false)
 ValueNumFuncDef(MUL_UN_OVF, 2, true, false, false)
 
+#ifdef FEATURE_HW_INTRINSICS
+// Pure hardware intrinsics (no memory access). Arg 0 is a constant encoding the intrinsic id,
+// base type and result type (see fgValueNumberHWIntrinsic); the remaining args are the operands.
+ValueNumFuncDef(HWIntrinsic0, 1, false, false, false)
+ValueNumFuncDef(HWIntrinsic1, 2, false, false, false)
+ValueNumFuncDef(HWIntrinsic2, 3, false, false, false)
+#endif // FEATURE_HW_INTRINSICS
+
 // clang-format on
 
 #undef ValueNumFuncDef
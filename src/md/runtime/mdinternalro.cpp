@@ -2012,7 +2012,14 @@ MDInternalRO::FindTypeDef(
             // If the class is nested and EnclosingClass passed is nil
             continue;
         }
-        else if (!IsNilToken(tkEnclosingClass))
+        
+        // Compare the name before looking up the enclosing class: the name is a direct string heap
+        // access, while the NestedClass lookup is a search, and most records fail on the name.
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
+        if (strcmp(szTypeDefName, szName) != 0)
+            continue;
+        
+        if (!IsNilToken(tkEnclosingClass))
         {
             _ASSERTE(TypeFromToken(tkEnclosingClass) == mdtTypeDef);
             
@@ -2029,15 +2036,11 @@ MDInternalRO::FindTypeDef(
                 continue;
         }
         
-        IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
-        if (strcmp(szTypeDefName, szName) == 0)
+        IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeDef(pTypeDefRec, &szNamespace));
+        if (strcmp(szTypeDefNamespace, szNamespace) == 0)
         {
-            IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeDef(pTypeDefRec, &szNamespace));
-            if (strcmp(szTypeDefNamespace, szNamespace) == 0)
-            {
-                *ptkTypeDef = TokenFromRid(i, mdtTypeDef);
-                return S_OK;
-            }
+            *ptkTypeDef = TokenFromRid(i, mdtTypeDef);
+            return S_OK;
         }
     }
     // Cannot find the TypeDef by name
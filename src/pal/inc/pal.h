@@ -2456,6 +2456,16 @@ size_t
 PALAPI
 PAL_GetRestrictedPhysicalMemoryLimit(VOID);
 
+PALIMPORT
+size_t
+PALAPI
+PAL_GetRestrictedPhysicalMemoryHigh(VOID);
+
+PALIMPORT
+BOOL
+PALAPI
+PAL_GetMemoryPressure(UINT* val);
+
 PALIMPORT
 BOOL
 PALAPI
@@ -2347,6 +2347,10 @@ void * MAPMapPEFile(HANDLE hFile)
     // request is successful, the mapping established by mmap() replaces any previous mappings for the process' pages
     // in the range from addr to addr + len." Thus, we will record a series of mappings here, one for the header
     // and each of the sections, as well as all the space between them that we give PROT_NONE protections.
+    //
+    // Each section is mapped MAP_PRIVATE directly from the file, so pages stay clean and are shared
+    // through the page cache across processes until something writes to them. For ReadyToRun images the
+    // only writes are base relocations (which R2R code largely avoids) and the writable data sections.
 
     // We're going to start adding mappings to the mapping list, so take the critical section
     InternalEnterCriticalSection(pThread, &mapping_critsec);
@@ -2502,6 +2506,18 @@ void * MAPMapPEFile(HANDLE hFile)
             goto doneReleaseMappingCriticalSection;
         }
 
+        // Code sections are touched almost immediately and in an order that demand paging handles badly
+        // on slow storage, so ask the kernel to start reading them in now. This only queues readahead
+        // into the page cache and does not populate the mapping, so failure is harmless and ignored.
+        if (currentHeader.Characteristics & IMAGE_SCN_MEM_EXECUTE)
+        {
+            size_t adviseSize = ((char*)sectionBase - (char*)sectionData) + currentHeader.SizeOfRawData;
+            if (-1 == madvise(sectionData, adviseSize, MADV_WILLNEED))
+            {
+                TRACE_(LOADER)("madvise(MADV_WILLNEED) of section %d failed with code %d\n", i, errno);
+            }
+        }
+
 #if _DEBUG
         {
             // Ensure null termination of section name (which is allowed to not be null terminated if exactly 8 characters long)
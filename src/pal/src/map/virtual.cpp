@@ -52,6 +52,11 @@ CRITICAL_SECTION virtual_critsec;
 // The first node in our list of allocated blocks.
 static PCMI pVirtualMemory;
 
+// The entry most recently returned by VIRTUALFindRegionInformation. Callers tend to commit, protect
+// and query the same reservation repeatedly, so this lets lookups skip the walk from the list head.
+// Protected by virtual_critsec like the list itself.
+static PCMI pLastFoundEntry;
+
 static size_t s_virtualPageSize = 0;
 
 /* We need MAP_ANON. However on some platforms like HP-UX, it is defined as MAP_ANONYMOUS */
@@ -173,6 +178,7 @@ VIRTUALInitialize(bool initializeExecutableMemoryAllocator)
     InternalInitializeCriticalSection(&virtual_critsec);
 
     pVirtualMemory = NULL;
+    pLastFoundEntry = NULL;
 
     if (initializeExecutableMemoryAllocator)
     {
@@ -210,6 +216,7 @@ void VIRTUALCleanup()
         free(pTempEntry );
     }
     pVirtualMemory = NULL;
+    pLastFoundEntry = NULL;
 
     InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
 
@@ -480,7 +487,13 @@ static PCMI VIRTUALFindRegionInformation( IN UINT_PTR address )
 
     TRACE( "VIRTUALFindRegionInformation( %#x )\n", address );
 
+    // The list is sorted by start address, so the walk can begin at the cached entry whenever the
+    // address is not below it.
     pEntry = pVirtualMemory;
+    if ( pLastFoundEntry && pLastFoundEntry->startBoundary <= address )
+    {
+        pEntry = pLastFoundEntry;
+    }
 
     while( pEntry )
     {
@@ -497,6 +510,11 @@ static PCMI VIRTUALFindRegionInformation( IN UINT_PTR address )
 
         pEntry = pEntry->pNext;
     }
+
+    if ( pEntry )
+    {
+        pLastFoundEntry = pEntry;
+    }
     return pEntry;
 }
 
@@ -519,6 +537,11 @@ static BOOL VIRTUALReleaseMemory( PCMI pMemoryToBeReleased )
         return FALSE;
     }
 
+    if ( pMemoryToBeReleased == pLastFoundEntry )
+    {
+        pLastFoundEntry = NULL;
+    }
+
     if ( pMemoryToBeReleased == pVirtualMemory )
     {
         /* This is either the first entry, or the only entry. */
@@ -16,6 +16,9 @@ Abstract:
 SET_DEFAULT_DEBUG_CHANNEL(MISC);
 #include "pal/palinternal.h"
 #include <sys/resource.h>
+#if defined(__linux__)
+#include <sys/vfs.h>
+#endif
 #include "pal/virtual.h"
 #include "pal/cgroup.h"
 #include <algorithm>
@@ -27,13 +30,30 @@ SET_DEFAULT_DEBUG_CHANNEL(MISC);
 #define MEM_USAGE_FILENAME "/memory.usage_in_bytes"
 #define CFS_QUOTA_FILENAME "/cpu.cfs_quota_us"
 #define CFS_PERIOD_FILENAME "/cpu.cfs_period_us"
+#define CGROUP2_MEM_LIMIT_FILENAME "/memory.max"
+#define CGROUP2_MEM_HIGH_FILENAME "/memory.high"
+#define CGROUP2_MEM_USAGE_FILENAME "/memory.current"
+#define CGROUP2_MEM_PRESSURE_FILENAME "/memory.pressure"
+#define CGROUP2_CPU_MAX_FILENAME "/cpu.max"
+#define CGROUP_MOUNT_PATH "/sys/fs/cgroup"
+
+#ifndef TMPFS_MAGIC
+#define TMPFS_MAGIC 0x01021994
+#endif
+#ifndef CGROUP2_SUPER_MAGIC
+#define CGROUP2_SUPER_MAGIC 0x63677270
+#endif
+
 class CGroup
 {
+    // 0 if cgroups are not mounted, otherwise 1 or 2 for the cgroup version in use.
+    static int s_cgroup_version;
     static char *s_memory_cgroup_path;
     static char *s_cpu_cgroup_path;
 public:
     static void Initialize()
     {
+        s_cgroup_version = FindCGroupVersion();
         s_memory_cgroup_path = FindCgroupPath(&IsMemorySubsystem);
         s_cpu_cgroup_path = FindCgroupPath(&IsCpuSubsystem);
     }
@@ -44,45 +64,50 @@ public:
         PAL_free(s_cpu_cgroup_path);
     }
     
+    // Note a cgroup v2 "max" (no limit) reads as 0, which callers treat as no limit.
     static bool GetPhysicalMemoryLimit(size_t *val)
     {
-        char *mem_limit_filename = nullptr;
-        bool result = false;
-
-        if (s_memory_cgroup_path == nullptr)
-            return result;
+        return ReadMemoryCGroupValue((s_cgroup_version == 2) ? CGROUP2_MEM_LIMIT_FILENAME : MEM_LIMIT_FILENAME, val);
+    }
 
-        size_t len = strlen(s_memory_cgroup_path);
-        len += strlen(MEM_LIMIT_FILENAME);
-        mem_limit_filename = (char*)PAL_malloc(len+1);
-        if (mem_limit_filename == nullptr)
-            return result;
+    // memory.high is where cgroup v2 starts throttling and reclaiming from the cgroup; there's
+    // no v1 equivalent we look at.
+    static bool GetPhysicalMemoryHigh(size_t *val)
+    {
+        if (s_cgroup_version != 2)
+            return false;
 
-        strcpy_s(mem_limit_filename, len+1, s_memory_cgroup_path);
-        strcat_s(mem_limit_filename, len+1, MEM_LIMIT_FILENAME);
-        result = ReadMemoryValueFromFile(mem_limit_filename, val);
-        PAL_free(mem_limit_filename);
-        return result;
+        return ReadMemoryCGroupValue(CGROUP2_MEM_HIGH_FILENAME, val);
     }
 
     static bool GetPhysicalMemoryUsage(size_t *val)
     {
-        char *mem_usage_filename = nullptr;
-        bool result = false;
+        return ReadMemoryCGroupValue((s_cgroup_version == 2) ? CGROUP2_MEM_USAGE_FILENAME : MEM_USAGE_FILENAME, val);
+    }
 
-        if (s_memory_cgroup_path == nullptr)
-            return result;
+    // Reads the "some avg10" memory pressure stall information, ie, the percentage of the last
+    // 10 seconds some task in the cgroup was stalled waiting for memory. This is only available
+    // with a v2 cgroup; the system wide /proc/pressure/memory says nothing about our own cgroup.
+    static bool GetMemoryPressure(UINT *val)
+    {
+        char *filename = nullptr;
+        bool result = false;
+        size_t len;
 
-        size_t len = strlen(s_memory_cgroup_path);
-        len += strlen(MEM_USAGE_FILENAME);
-        mem_usage_filename = (char*)malloc(len+1);
-        if (mem_usage_filename == nullptr)
-            return result;
+        if ((s_cgroup_version == 2) && (s_memory_cgroup_path != nullptr))
+        {
+            len = strlen(s_memory_cgroup_path);
+            len += strlen(CGROUP2_MEM_PRESSURE_FILENAME);
+            filename = (char*)PAL_malloc(len+1);
+            if (filename == nullptr)
+                return result;
+
+            strcpy_s(filename, len+1, s_memory_cgroup_path);
+            strcat_s(filename, len+1, CGROUP2_MEM_PRESSURE_FILENAME);
+            result = ReadPressureValueFromFile(filename, val);
+            PAL_free(filename);
+        }
 
-        strcpy(mem_usage_filename, s_memory_cgroup_path);
-        strcat(mem_usage_filename, MEM_USAGE_FILENAME);
-        result = ReadMemoryValueFromFile(mem_usage_filename, val);
-        free(mem_usage_filename);
         return result;
     }
 
@@ -92,11 +117,20 @@ public:
         long long period;
         double cpu_count;
 
-        quota = ReadCpuCGroupValue(CFS_QUOTA_FILENAME);
+        if (s_cgroup_version == 2)
+        {
+            if (!ReadCGroup2CpuMax(&quota, &period))
+                return false;
+        }
+        else
+        {
+            quota = ReadCpuCGroupValue(CFS_QUOTA_FILENAME);
+            period = ReadCpuCGroupValue(CFS_PERIOD_FILENAME);
+        }
+
         if (quota <= 0)
             return false;
 
-        period = ReadCpuCGroupValue(CFS_PERIOD_FILENAME);
         if (period <= 0)
             return false;
 
@@ -115,6 +149,26 @@ public:
     }
 
 private:
+    static int FindCGroupVersion()
+    {
+#if defined(__linux__)
+        // With cgroup v1 the cgroup mount point is a tmpfs with one cgroup mount per
+        // controller under it, with cgroup v2 it's the unified cgroup2 hierarchy itself.
+        struct statfs stats;
+        if (statfs(CGROUP_MOUNT_PATH, &stats) != 0)
+            return 0;
+
+        switch (stats.f_type)
+        {
+            case TMPFS_MAGIC: return 1;
+            case CGROUP2_SUPER_MAGIC: return 2;
+            default: return 0;
+        }
+#else
+        return 1;
+#endif
+    }
+
     static bool IsMemorySubsystem(const char *strTok){
         return strcmp("memory", strTok) == 0;
     }
@@ -197,7 +251,32 @@ private:
                 goto done;
             }
 
-            if (strncmp(filesystemType, "cgroup", 6) == 0)
+            if (s_cgroup_version == 2)
+            {
+                // The v2 hierarchy has every controller, so the first cgroup2 mount is the one.
+                if (strcmp(filesystemType, "cgroup2") == 0)
+                {
+                    mountpath = (char*)PAL_malloc(lineLen+1);
+                    if (mountpath == nullptr)
+                        goto done;
+                    mountroot = (char*)PAL_malloc(lineLen+1);
+                    if (mountroot == nullptr)
+                        goto done;
+
+                    sscanfRet = sscanf_s(line,
+                                         "%*s %*s %*s %s %s ",
+                                         mountroot, lineLen+1,
+                                         mountpath, lineLen+1);
+                    if (sscanfRet != 2)
+                        _ASSERTE(!"Failed to parse mount info file contents with sscanf_s.");
+
+                    *pmountpath = mountpath;
+                    *pmountroot = mountroot;
+                    mountpath = mountroot = nullptr;
+                    goto done;
+                }
+            }
+            else if (strncmp(filesystemType, "cgroup", 6) == 0)
             {
                 char* context = nullptr;
                 char* strTok = strtok_s(options, ",", &context); 
@@ -267,6 +346,16 @@ private:
                 maxLineLen = lineLen;
             }
 
+            if (s_cgroup_version == 2)
+            {
+                // In cgroup v2 the process is in a single cgroup, listed as "0::<path>".
+                if (sscanf_s(line, "0::%s", cgroup_path, lineLen+1) == 1)
+                {
+                    result = true;
+                }
+                continue;
+            }
+
             // See man page of proc to get format for /proc/self/cgroup file
             int sscanfRet = sscanf_s(line, 
                                      "%*[^:]:%[^:]:%s",
@@ -303,11 +392,111 @@ private:
         return cgroup_path;
     }
 
+    static bool ReadMemoryCGroupValue(const char* subsystemFilename, size_t* val)
+    {
+        char *filename = nullptr;
+        bool result = false;
+        size_t len;
+
+        if (s_memory_cgroup_path == nullptr)
+            return result;
+
+        len = strlen(s_memory_cgroup_path);
+        len += strlen(subsystemFilename);
+        filename = (char*)PAL_malloc(len+1);
+        if (filename == nullptr)
+            return result;
+
+        strcpy_s(filename, len+1, s_memory_cgroup_path);
+        strcat_s(filename, len+1, subsystemFilename);
+        result = ReadMemoryValueFromFile(filename, val);
+        PAL_free(filename);
+        return result;
+    }
+
     static bool ReadMemoryValueFromFile(const char* filename, size_t* val)
     {
         return ::ReadMemoryValueFromFile(filename, val);
     }
 
+    // The first line of a PSI file looks like "some avg10=1.23 avg60=0.50 avg300=0.10 total=12345".
+    static bool ReadPressureValueFromFile(const char* filename, UINT* val)
+    {
+        bool result = false;
+        char *line = nullptr;
+        size_t lineLen = 0;
+        float avg10 = 0;
+
+        if (val == nullptr)
+            return false;
+
+        FILE* file = fopen(filename, "r");
+        if (file == nullptr)
+            goto done;
+
+        if (getline(&line, &lineLen, file) == -1)
+            goto done;
+
+        if (sscanf_s(line, "some avg10=%f", &avg10) != 1)
+            goto done;
+
+        *val = (avg10 >= 100.0f) ? 100 : ((avg10 <= 0.0f) ? 0 : (UINT)avg10);
+        result = true;
+    done:
+        if (file)
+            fclose(file);
+        free(line);
+        return result;
+    }
+
+    // cpu.max is "<quota> <period>", with the quota being "max" when there's no limit.
+    static bool ReadCGroup2CpuMax(long long* quota, long long* period)
+    {
+        char *filename = nullptr;
+        char *line = nullptr;
+        size_t lineLen = 0;
+        FILE* file = nullptr;
+        bool result = false;
+        size_t len;
+
+        if (s_cpu_cgroup_path == nullptr)
+            return false;
+
+        len = strlen(s_cpu_cgroup_path);
+        len += strlen(CGROUP2_CPU_MAX_FILENAME);
+        filename = (char*)PAL_malloc(len+1);
+        if (filename == nullptr)
+            return false;
+
+        strcpy_s(filename, len+1, s_cpu_cgroup_path);
+        strcat_s(filename, len+1, CGROUP2_CPU_MAX_FILENAME);
+
+        file = fopen(filename, "r");
+        if (file == nullptr)
+            goto done;
+
+        if (getline(&line, &lineLen, file) == -1)
+            goto done;
+
+        if (strncmp(line, "max", 3) == 0)
+        {
+            *quota = -1;
+            *period = -1;
+        }
+        else if (sscanf_s(line, "%lld %lld", quota, period) != 2)
+        {
+            goto done;
+        }
+
+        result = true;
+    done:
+        if (file)
+            fclose(file);
+        free(line);
+        PAL_free(filename);
+        return result;
+    }
+
     static long long ReadCpuCGroupValue(const char* subsystemFilename){
         char *filename = nullptr;
         bool result = false;
@@ -363,6 +552,7 @@ private:
     }
 };
 
+int CGroup::s_cgroup_version = 0;
 char *CGroup::s_memory_cgroup_path = nullptr;
 char *CGroup::s_cpu_cgroup_path = nullptr;
 
@@ -419,6 +609,31 @@ PAL_GetRestrictedPhysicalMemoryLimit()
     return physical_memory_limit;
 }
 
+size_t
+PALAPI
+PAL_GetRestrictedPhysicalMemoryHigh()
+{
+    size_t physical_memory_high = 0;
+
+    if (!CGroup::GetPhysicalMemoryHigh(&physical_memory_high))
+        return 0;
+
+    if (physical_memory_high > 0x7FFFFFFF00000000)
+        return 0;
+
+    return physical_memory_high;
+}
+
+BOOL
+PALAPI
+PAL_GetMemoryPressure(UINT* val)
+{
+    if (val == nullptr)
+        return FALSE;
+
+    return CGroup::GetMemoryPressure(val);
+}
+
 BOOL
 PALAPI
 PAL_GetPhysicalMemoryUsed(size_t* val)
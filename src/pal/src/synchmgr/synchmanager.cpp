@@ -192,6 +192,15 @@ namespace CorUnix
 
     NOTE: This method must must be called without holding any
           synchronization lock (as well as other locks)
+
+    PERF: Objects in the ProcessLocalObject domain never touch the
+          shared memory lock. Acquiring or signaling them takes
+          s_csSynchProcessLock, a pthread mutex that is futex based and
+          does not enter the kernel when uncontended. Blocked threads
+          sleep on their own condition variable. A wait that has to
+          block therefore already costs one futex sleep and one futex
+          wake. The remaining overhead is the per-process lock, not
+          cross-process machinery.
     --*/
     PAL_ERROR CPalSynchronizationManager::BlockThread(
         CPalThread *pthrCurrent,
@@ -15,6 +15,8 @@
 
 INDEBUG(DWORD UnlockedLoaderHeap::s_dwNumInstancesOfLoaderHeaps = 0;)
 
+LONG64 UnlockedLoaderHeap::s_totalCommittedBytes = 0;
+
 #ifdef RANDOMIZE_ALLOC
 #include <time.h>
 static class Random
@@ -999,6 +1001,8 @@ UnlockedLoaderHeap::~UnlockedLoaderHeap()
     if (m_pPrivatePerfCounter_LoaderBytes)
         *m_pPrivatePerfCounter_LoaderBytes = *m_pPrivatePerfCounter_LoaderBytes - (DWORD) m_dwTotalAlloc;
 
+    InterlockedExchangeAdd64(&s_totalCommittedBytes, -(LONG64)m_dwTotalAlloc);
+
     INDEBUG(s_dwNumInstancesOfLoaderHeaps --;)
 }
 
@@ -1167,6 +1171,7 @@ BOOL UnlockedLoaderHeap::UnlockedReservePages(size_t dwSizeToCommit)
     }
 
     m_dwTotalAlloc += dwSizeToCommit;
+    InterlockedExchangeAdd64(&s_totalCommittedBytes, (LONG64)dwSizeToCommit);
 
     LoaderHeapBlock *pNewBlock;
 
@@ -1235,6 +1240,7 @@ BOOL UnlockedLoaderHeap::GetMoreCommittedPages(size_t dwMinSize)
             *m_pPrivatePerfCounter_LoaderBytes = *m_pPrivatePerfCounter_LoaderBytes + (DWORD) dwSizeToCommit;
 
         m_dwTotalAlloc += dwSizeToCommit;
+        InterlockedExchangeAdd64(&s_totalCommittedBytes, (LONG64)dwSizeToCommit);
 
         m_pPtrToEndOfCommittedRegion += dwSizeToCommit;
         return TRUE;
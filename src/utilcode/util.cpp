@@ -1237,6 +1237,9 @@ int GetCurrentProcessCpuCount()
     }
 
 #else // !FEATURE_PAL
+    // Unlike the affinity mask path above, there is no 64 processor cap here. The PAL counts
+    // the process's sched_getaffinity set, which may be sparse (cpusets), and the GC builds its
+    // AffinitySet (up to MAX_SUPPORTED_CPUS) from the same set.
     count = PAL_GetLogicalCpuCountFromOS();
 
     uint32_t cpuLimit;
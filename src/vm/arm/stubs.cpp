@@ -1043,11 +1043,12 @@ void ResolveHolder::Initialize(PCODE resolveWorkerTarget, PCODE patcherTarget,
     // push {r5,r6}
     _stub._resolveEntryPoint[n++] = 0xb460;
 
-    // ;; Compute i = ((mt + mt >> 12) ^ this._hashedToken) & this._cacheMask
+    // ;; Compute i = ((mt + mt >> CALL_STUB_CACHE_NUM_BITS) ^ this._hashedToken) & this._cacheMask
 
-    // add r6, r12, r12 lsr #12
+    // add r6, r12, r12 lsr #CALL_STUB_CACHE_NUM_BITS
+    // The shift amount is split into imm3 (bits 12-14) and imm2 (bits 6-7) of the second halfword
     _stub._resolveEntryPoint[n++] = 0xeb0c;
-    _stub._resolveEntryPoint[n++] = 0x361c;
+    _stub._resolveEntryPoint[n++] = 0x061c | ((CALL_STUB_CACHE_NUM_BITS >> 2) << 12) | ((CALL_STUB_CACHE_NUM_BITS & 3) << 6);
 
     // ldr r5, [pc + #_hashedToken]
     offset = PC_REL_OFFSET(_hashedToken);
@@ -201,7 +201,7 @@ struct ResolveHolder
          // ResolveStub._resolveEntryPoint(x0:Object*, x1 ...,r7, x11:IndirectionCellAndFlags)
          // {
          //    MethodTable mt = x0.m_pMethTab;
-         //    int i = ((mt + mt >> 12) ^ this._hashedToken) & _cacheMask
+         //    int i = ((mt + mt >> CALL_STUB_CACHE_NUM_BITS) ^ this._hashedToken) & _cacheMask
          //    ResolveCacheElem e = this._cacheAddress + i
          //    x9 = e = this._cacheAddress + i
          //    if (mt == e.pMT && this._token == e.token)
@@ -223,10 +223,10 @@ struct ResolveHolder
          //ldr x12, [x0,#Object.m_pMethTab ] ; methodTable from object in x0
          _stub._resolveEntryPoint[n++] = RESOLVE_STUB_FIRST_DWORD; //0xF940000C
          
-         //  ;; Compute i = ((mt + mt >> 12) ^ this._hashedToken) & _cacheMask
+         //  ;; Compute i = ((mt + mt >> CALL_STUB_CACHE_NUM_BITS) ^ this._hashedToken) & _cacheMask
         
-         //add x9, x12, x12 lsr #12
-         _stub._resolveEntryPoint[n++] = 0x8B4C3189;
+         //add x9, x12, x12 lsr #CALL_STUB_CACHE_NUM_BITS
+         _stub._resolveEntryPoint[n++] = 0x8B4C0189 | (CALL_STUB_CACHE_NUM_BITS << 10);
 
          //;;adr x10, #Dataregionbase of ResolveStub 
          _stub._resolveEntryPoint[n++] = 0x1000000A | ARM64EncodeHelpers::ADR_PATCH(PC_REL_OFFSET(Dataregionbase));
@@ -240,10 +240,11 @@ struct ResolveHolder
          //eor x9,x9,x13
          _stub._resolveEntryPoint[n++] = 0xCA0D0129;
 
-         _ASSERTE(CALL_STUB_CACHE_MASK * sizeof(void*) == 0x7FF8);
+         // The logical immediate encodes a run of CALL_STUB_CACHE_NUM_BITS ones rotated right by 61, i.e. shifted left by 3
+         _ASSERTE(CALL_STUB_CACHE_MASK * sizeof(void*) == (((size_t)1 << CALL_STUB_CACHE_NUM_BITS) - 1) << 3);
          //x9-i
          //and x9,x9,#cachemask
-         _stub._resolveEntryPoint[n++] = 0x927D2D29;
+         _stub._resolveEntryPoint[n++] = 0x927D0129 | ((CALL_STUB_CACHE_NUM_BITS - 1) << 10);
 
          //;; ResolveCacheElem e = this._cacheAddress + i
          //
@@ -136,6 +136,13 @@ void CallCounter::OnMethodCalled(
     // callback directly into the jitted code would eliminate CPU overhead of 
     // leaving the prestub unpatched, but may not be good overall as it increases
     // the size of the jitted code.
+    //
+    // Per-method call counting stubs (a small stub that decrements an inline counter and
+    // jumps to the tier 0 code, deleted in bulk once methods are promoted) would remove
+    // both the lock and the lookup. They need a stub for each architecture and a way to
+    // redirect every entry point of a method, including backpatchable vtable slots, to
+    // the stub and back. Until that exists, the lock below is held only across a single
+    // lookup and decrement, and the prestub stops calling here once a method is promoted.
 
     bool isFirstCall = false;
     int callCountLimit;
@@ -994,6 +994,12 @@ void EEStartupHelper(COINITIEE fFlags)
 
 #ifndef CROSSGEN_COMPILE
 
+#ifdef FEATURE_EVENT_TRACE
+        // Close the startup span opened by EEStartupStart so that EE initialization time can be read
+        // directly from the trace.
+        ETWFireEvent(EEStartupEnd_V1);
+#endif // FEATURE_EVENT_TRACE
+
 #ifdef _DEBUG
 
         //if g_fEEStarted was false when we loaded the System Module, we did not run ExpandAll on it.  In
@@ -1058,6 +1058,7 @@ void ClassLoader::LazyPopulateCaseSensitiveHashTables()
 
         // Lazy construction of the case-sensitive hashtable of types is *only* a scenario for ReadyToRun images
         // (either images compiled with an old version of crossgen, or for case-insensitive type lookups in R2R modules)
+        // IL-only modules build their table when the module is loaded, since every name lookup would need it.
         _ASSERT(pModule->IsReadyToRun());
 
         EEClassHashTable * pNewClassHash = EEClassHashTable::Create(pModule, AVAILABLE_CLASSES_HASH_BUCKETS, FALSE /* bCaseInsensitive */, &amTracker);
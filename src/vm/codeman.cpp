@@ -57,11 +57,10 @@ SPTR_IMPL(ReadyToRunJitManager, ExecutionManager, m_pReadyToRunJitManager);
 
 #ifndef DACCESS_COMPILE
 Volatile<RangeSection *> ExecutionManager::m_CodeRangeList = NULL;
-Volatile<LONG> ExecutionManager::m_dwReaderCount = 0;
+ExecutionManager::ReaderCountStripe ExecutionManager::m_ReaderCountStripes[ExecutionManager::ReaderCountStripeCount];
 Volatile<LONG> ExecutionManager::m_dwWriterLock = 0;
 #else
 SPTR_IMPL(RangeSection, ExecutionManager, m_CodeRangeList);
-SVAL_IMPL(LONG, ExecutionManager, m_dwReaderCount);
 SVAL_IMPL(LONG, ExecutionManager, m_dwWriterLock);
 #endif
 
@@ -655,6 +654,30 @@ BOOL EEJitManager::CodeHeapIterator::Next()
 // writer lock and check for any readers. If there are any, the WriterLockHolder functions
 // release the writer and yield to wait for the readers to be done.
 
+DWORD ExecutionManager::GetReaderCountStripeIndex()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    static_assert_no_msg((ReaderCountStripeCount & (ReaderCountStripeCount - 1)) == 0);
+
+    // Thread ids are often allocated sequentially or in multiples of 4, so spread them with a
+    // multiplicative hash before picking a stripe.
+    DWORD hash = GetCurrentThreadId() * 0x9E3779B1;
+    return (hash >> 16) & (ReaderCountStripeCount - 1);
+}
+
+BOOL ExecutionManager::AreThereAnyReaders()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (DWORD i = 0; i < ReaderCountStripeCount; i++)
+    {
+        if (m_ReaderCountStripes[i].m_dwCount != 0)
+            return TRUE;
+    }
+    return FALSE;
+}
+
 ExecutionManager::ReaderLockHolder::ReaderLockHolder(HostCallPreference hostCallPreference /*=AllowHostCalls*/)
 {
     CONTRACTL {
@@ -666,7 +689,8 @@ ExecutionManager::ReaderLockHolder::ReaderLockHolder(HostCallPreference hostCall
 
     IncCantAllocCount();
 
-    FastInterlockIncrement(&m_dwReaderCount);
+    m_stripeIndex = GetReaderCountStripeIndex();
+    FastInterlockIncrement(&m_ReaderCountStripes[m_stripeIndex].m_dwCount);
 
     EE_LOCK_TAKEN(GetPtrForLockContract());
 
@@ -699,7 +723,7 @@ ExecutionManager::ReaderLockHolder::~ReaderLockHolder()
     }
     CONTRACTL_END;
 
-    FastInterlockDecrement(&m_dwReaderCount);
+    FastInterlockDecrement(&m_ReaderCountStripes[m_stripeIndex].m_dwCount);
     DecCantAllocCount();
 
     EE_LOCK_RELEASED(GetPtrForLockContract());
@@ -738,7 +762,7 @@ ExecutionManager::WriterLockHolder::WriterLockHolder()
         Thread::IncForbidSuspendThread();
 
         FastInterlockIncrement(&m_dwWriterLock);
-        if (m_dwReaderCount == 0)
+        if (!AreThereAnyReaders())
             break;
         FastInterlockDecrement(&m_dwWriterLock);
 
@@ -1342,6 +1366,8 @@ void EEJitManager::SetCpuInfo()
     //      CORJIT_FLAG_USE_AVX
     //      AVX2      - EBX bit 5    (buffer[4]  & 0x20)
     //   CORJIT_FLAG_USE_AVX_512 is not currently set, but defined so that it can be used in future without
+    //   synchronously updating VM and JIT. Setting it will also require checking that the OS saves the
+    //   opmask and upper ZMM state (XCR0[7:5] 111b), and the JIT has no EVEX encoder to consume it yet.
     //   CORJIT_FLAG_USE_AES
     //      CORJIT_FLAG_USE_SSE2
     //      AES       - ECX bit 25   (buffer[11] & 0x01)
@@ -1354,7 +1380,6 @@ void EEJitManager::SetCpuInfo()
     //      BMI2 - EBX bit 8         (buffer[5]  & 0x01)
     //   CORJIT_FLAG_USE_LZCNT if the following feature bits are set (input EAX of 80000001H)
     //      LZCNT - ECX bit 5        (buffer[8]  & 0x20)
-    // synchronously updating VM and JIT.
 
     unsigned char buffer[16];
     DWORD maxCpuId = getcpuid(0, buffer);
@@ -1438,7 +1463,8 @@ void EEJitManager::SetCpuInfo()
                 CPUCompileFlags.Set(CORJIT_FLAGS::CORJIT_FLAG_FEATURE_SIMD);
             }
 
-            if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_SIMD16ByteOnly) != 0)
+            // Pins Vector<T> to 16 bytes, so its size no longer depends on whether the machine has AVX2.
+            if (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_SIMD16ByteOnly) != 0)
             {
                 CPUCompileFlags.Clear(CORJIT_FLAGS::CORJIT_FLAG_USE_AVX2);
             }
@@ -2125,6 +2151,9 @@ static size_t GetDefaultReserveForJumpStubs(size_t codeHeapSize)
 #endif
 }
 
+// Code heaps are committed read-write-execute and the JIT, precode and stub generators write
+// straight into them at their final addresses. Enforcing W^X would need a separate writable view
+// of every executable page, and every writer in the VM would have to target that view.
 HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap *pJitMetaHeap)
 {
     CONTRACT(HeapList *) {
@@ -4506,8 +4535,11 @@ RangeSection* ExecutionManager::GetRangeSection(TADDR addr)
     // Cache pCurr as pLastUsed in the head node
     // Unless we are on an MP system with many cpus
     // where this sort of caching actually diminishes scaling during server GC
-    // due to many processors writing to a common location
-    if (g_SystemInfo.dwNumberOfProcessors < 4 || !GCHeapUtilities::IsServerHeap() || !GCHeapUtilities::IsGCInProgress())
+    // due to many processors writing to a common location.
+    // Also skip the store if the cached value is already right, so that lookups from
+    // many threads don't keep invalidating the head node's cache line.
+    if (pHead->pLastUsed != pLast &&
+        (g_SystemInfo.dwNumberOfProcessors < 4 || !GCHeapUtilities::IsServerHeap() || !GCHeapUtilities::IsGCInProgress()))
         pHead->pLastUsed = pLast;
 #endif
 
@@ -1277,6 +1277,12 @@ public:
         ~ReaderLockHolder();
 
         BOOL Acquired();
+
+#ifndef DACCESS_COMPILE
+    private:
+        // Index of the reader count stripe this holder incremented
+        DWORD m_stripeIndex;
+#endif
     };
 
 #ifdef _TARGET_64BIT_
@@ -1384,12 +1390,23 @@ private:
     // infrastructure to manage readers so we can lock them out and delete domain data
     // make ReaderCount volatile because we have order dependency in READER_INCREMENT
 #ifndef DACCESS_COMPILE
+    // Readers are counted in separate cache lines picked by thread id, so that the many concurrent
+    // lookups done by stack walks, exception dispatch and GC stack scans don't all contend on a
+    // single counter. A writer waits for every stripe to drop to zero.
+    struct DECLSPEC_ALIGN(MAX_CACHE_LINE_SIZE) ReaderCountStripe
+    {
+        Volatile<LONG> m_dwCount;
+    };
+    static const DWORD      ReaderCountStripeCount = 16;
+
     static Volatile<RangeSection *> m_CodeRangeList;
-    static Volatile<LONG>   m_dwReaderCount;
+    static ReaderCountStripe m_ReaderCountStripes[ReaderCountStripeCount];
     static Volatile<LONG>   m_dwWriterLock;
+
+    static DWORD GetReaderCountStripeIndex();
+    static BOOL AreThereAnyReaders();
 #else
     SPTR_DECL(RangeSection,  m_CodeRangeList);
-    SVAL_DECL(LONG, m_dwReaderCount);
     SVAL_DECL(LONG, m_dwWriterLock);
 #endif
 
@@ -1406,7 +1423,7 @@ private:
     // The LOCK_TAKEN/RELEASED macros need a "pointer" to the lock object to do
     // comparisons between takes & releases (and to provide debugging info to the
     // developer).  Since Inc/Dec Reader/Writer are static, there's no object to
-    // use.  So we just use the pointer to m_dwReaderCount.  Note that both
+    // use.  So we just use the pointer to m_dwWriterLock.  Note that both
     // readers & writers use this same pointer, which follows the general convention
     // of other ReaderWriter locks in the EE code base: each reader/writer locking object
     // instance protects only 1 piece of data or code.  Readers & writers both access the
@@ -1414,7 +1431,7 @@ private:
     // lock pointer.
     static void * GetPtrForLockContract()
     {
-        return (void *) &m_dwReaderCount;
+        return (void *) &m_dwWriterLock;
     }
 #endif // defined(_DEBUG)
 
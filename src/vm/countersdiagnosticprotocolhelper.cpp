@@ -0,0 +1,75 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+#include "common.h"
+#include "countersdiagnosticprotocolhelper.h"
+#include "diagnosticsipc.h"
+#include "diagnosticsprotocol.h"
+#include "gcheaputilities.h"
+#include "threadpoolrequest.h"
+
+#ifdef FEATURE_PERFTRACING
+
+void CountersDiagnosticProtocolHelper::HandleIpcMessage(DiagnosticsIpc::IpcMessage& message, IpcStream* pStream)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+        PRECONDITION(pStream != nullptr);
+    }
+    CONTRACTL_END;
+
+    switch ((CountersCommandId)message.GetHeader().CommandId)
+    {
+    case CountersCommandId::GetRuntimeCounters:
+        CountersDiagnosticProtocolHelper::GetRuntimeCounters(message, pStream);
+        break;
+
+    default:
+        STRESS_LOG1(LF_DIAGNOSTICS_PORT, LL_WARNING, "Received unknown request type (%d)\n", message.GetHeader().CommandSet);
+        DiagnosticsIpc::IpcMessage::SendErrorMessage(pStream, CORDIAGIPC_E_UNKNOWN_COMMAND);
+        delete pStream;
+        break;
+    }
+}
+
+void CountersDiagnosticProtocolHelper::GetRuntimeCounters(DiagnosticsIpc::IpcMessage& message, IpcStream* pStream)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+        PRECONDITION(pStream != nullptr);
+    }
+    CONTRACTL_END;
+
+    if (pStream == nullptr)
+        return;
+
+    // These are the same values the managed runtime counters read, taken directly from the VM so
+    // that a client can poll them without starting an EventPipe session. The thread pool and lock
+    // contention counts are summed over the per-thread counters under the thread store lock.
+    IGCHeap *pHeap = GCHeapUtilities::GetGCHeap();
+
+    RuntimeCountersPayload payload = {};
+    payload.GCHeapSizeBytes = pHeap->GetTotalBytesInUse();
+    payload.TotalAllocatedBytes = pHeap->GetTotalAllocatedBytes();
+    payload.Gen0CollectionCount = pHeap->CollectionCount(0);
+    payload.Gen1CollectionCount = pHeap->CollectionCount(1);
+    payload.Gen2CollectionCount = pHeap->CollectionCount(2);
+    payload.ThreadPoolCompletedWorkItemCount = Thread::GetTotalThreadPoolCompletionCount();
+    payload.ThreadPoolPendingUnmanagedWorkItemCount = PerAppDomainTPCountList::GetUnmanagedTPCount()->GetNumRequests();
+    payload.MonitorLockContentionCount = Thread::GetTotalMonitorLockContentionCount();
+    payload.LoaderHeapCommittedBytes = UnlockedLoaderHeap::GetTotalCommittedBytes();
+
+    DiagnosticsIpc::IpcMessage successResponse;
+    if (successResponse.Initialize(DiagnosticsIpc::GenericSuccessHeader, payload))
+        successResponse.Send(pStream);
+    delete pStream;
+}
+
+#endif // FEATURE_PERFTRACING
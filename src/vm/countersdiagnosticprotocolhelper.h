@@ -0,0 +1,59 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+#ifndef __COUNTERS_DIAGNOSTIC_PROTOCOL_HELPER_H__
+#define __COUNTERS_DIAGNOSTIC_PROTOCOL_HELPER_H__
+
+#ifdef FEATURE_PERFTRACING
+
+#include "common.h"
+#include <diagnosticsprotocol.h>
+
+
+class IpcStream;
+
+// The Counters command set is 0x04
+enum class CountersCommandId : uint8_t
+{
+    // reserved      = 0x00,
+    GetRuntimeCounters = 0x01,
+    // future
+};
+
+// The protocol buffer for the GetRuntimeCounters response is defined as:
+//   ulong - GC heap size in bytes
+//   ulong - total bytes allocated
+//   ulong - gen0 GC count
+//   ulong - gen1 GC count
+//   ulong - gen2 GC count
+//   ulong - thread pool completed work item count
+//   ulong - unmanaged thread pool pending work item count
+//   ulong - monitor lock contention count
+//   ulong - bytes committed by loader heaps (type data, stubs and jitted code)
+//
+// All fields are 64 bits wide so the layout has no padding.
+struct RuntimeCountersPayload
+{
+    uint64_t GCHeapSizeBytes;
+    uint64_t TotalAllocatedBytes;
+    uint64_t Gen0CollectionCount;
+    uint64_t Gen1CollectionCount;
+    uint64_t Gen2CollectionCount;
+    uint64_t ThreadPoolCompletedWorkItemCount;
+    uint64_t ThreadPoolPendingUnmanagedWorkItemCount;
+    uint64_t MonitorLockContentionCount;
+    uint64_t LoaderHeapCommittedBytes;
+};
+
+class CountersDiagnosticProtocolHelper
+{
+public:
+    // IPC event handlers.
+    static void HandleIpcMessage(DiagnosticsIpc::IpcMessage& message, IpcStream *pStream);
+    static void GetRuntimeCounters(DiagnosticsIpc::IpcMessage& message, IpcStream *pStream);
+};
+
+#endif // FEATURE_PERFTRACING
+
+#endif // __COUNTERS_DIAGNOSTIC_PROTOCOL_HELPER_H__
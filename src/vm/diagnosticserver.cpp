@@ -7,6 +7,7 @@
 #include "eventpipeprotocolhelper.h"
 #include "dumpdiagnosticprotocolhelper.h"
 #include "profilerdiagnosticprotocolhelper.h"
+#include "countersdiagnosticprotocolhelper.h"
 #include "diagnosticsprotocol.h"
 
 #ifdef FEATURE_PAL
@@ -88,6 +89,10 @@ static DWORD WINAPI DiagnosticsServerThread(LPVOID lpThreadParameter)
                 break;
 #endif // FEATURE_PROFAPI_ATTACH_DETACH
 
+            case DiagnosticsIpc::DiagnosticServerCommandSet::Counters:
+                CountersDiagnosticProtocolHelper::HandleIpcMessage(message, pStream);
+                break;
+
             default:
                 STRESS_LOG1(LF_DIAGNOSTICS_PORT, LL_WARNING, "Received unknown request type (%d)\n", message.GetHeader().CommandSet);
                 DiagnosticsIpc::IpcMessage::SendErrorMessage(pStream, CORDIAGIPC_E_UNKNOWN_COMMAND);
@@ -3223,6 +3223,11 @@ HRESULT NDirect::HasNAT_LAttribute(IMDInternalImport *pInternalImport, mdToken t
 
 
 // Either MD or signature & module must be given.
+//
+// When this returns FALSE the JIT can inline the P/Invoke transition into the caller and no IL
+// stub is generated. The transition itself (InlinedCallFrame and the GC mode switch) is still
+// needed; only its placement differs. See Compiler::impCanPInvokeInlineCallSite for the call
+// sites (handlers, try regions on 64-bit) where the JIT must fall back to the stub.
 /*static*/
 BOOL NDirect::MarshalingRequired(MethodDesc *pMD, PCCOR_SIGNATURE pSig /*= NULL*/, Module *pModule /*= NULL*/)
 {
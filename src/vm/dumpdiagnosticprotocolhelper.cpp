@@ -91,6 +91,9 @@ void DumpDiagnosticProtocolHelper::GenerateCoreDump(DiagnosticsIpc::IpcMessage&
         return;
     }
 
+    // PAL_GenerateCoreDump forks createdump and waits for it to finish. That is fine on the diagnostics
+    // server thread, but it is not something that can be started from a runtime event such as the end of
+    // a GC, since the triggering thread would block for the duration of the dump.
     MAKE_UTF8PTR_FROMWIDE_NOTHROW(szDumpName, payload->dumpName);
     if (szDumpName != nullptr)
     {
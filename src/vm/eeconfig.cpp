@@ -352,9 +352,12 @@ HRESULT EEConfig::Init()
     fTieredCompilation = false;
     fTieredCompilation_QuickJit = false;
     fTieredCompilation_QuickJitForLoops = false;
+    fTieredCompilation_OnStackReplacement = false;
+    fTieredPGO = false;
     fTieredCompilation_CallCounting = false;
     tieredCompilation_CallCountThreshold = 1;
     tieredCompilation_CallCountingDelayMs = 0;
+    tieredCompilation_BackgroundWorkerCount = 1;
 #endif
 
 #ifndef CROSSGEN_COMPILE
@@ -1215,10 +1218,21 @@ fTrackDynamicMethodDebugInfo = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_
                 Configuration::GetKnobBooleanValue(
                     W("System.Runtime.TieredCompilation.QuickJitForLoops"),
                     CLRConfig::UNSUPPORTED_TC_QuickJitForLoops);
+
+            // Patchpoints are what keep a tier-0 method with a hot loop from being
+            // stuck there, so quick JIT for loops comes with them.
+            fTieredCompilation_OnStackReplacement =
+                CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TC_OnStackReplacement) != 0;
+            if (fTieredCompilation_OnStackReplacement)
+            {
+                fTieredCompilation_QuickJitForLoops = true;
+            }
         }
 
         fTieredCompilation_CallCounting = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_CallCounting) != 0;
 
+        fTieredPGO = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TieredPGO) != 0;
+
         tieredCompilation_CallCountThreshold = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_CallCountThreshold);
         if (tieredCompilation_CallCountThreshold < 1)
         {
@@ -1249,6 +1263,18 @@ fTrackDynamicMethodDebugInfo = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_
             }
         }
 
+        // Leave at least one processor for the threads running tier 0 code, but always allow one worker
+        tieredCompilation_BackgroundWorkerCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerCount);
+        DWORD processorCount = (DWORD)GetCurrentProcessCpuCount();
+        if (tieredCompilation_BackgroundWorkerCount >= processorCount)
+        {
+            tieredCompilation_BackgroundWorkerCount = processorCount - 1;
+        }
+        if (tieredCompilation_BackgroundWorkerCount < 1)
+        {
+            tieredCompilation_BackgroundWorkerCount = 1;
+        }
+
         if (ETW::CompilationLog::TieredCompilation::Runtime::IsEnabled())
         {
             ETW::CompilationLog::TieredCompilation::Runtime::SendSettings();
@@ -286,9 +286,12 @@ public:
     bool          TieredCompilation(void)           const { LIMITED_METHOD_CONTRACT;  return fTieredCompilation; }
     bool          TieredCompilation_QuickJit() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_QuickJit; }
     bool          TieredCompilation_QuickJitForLoops() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_QuickJitForLoops; }
+    bool          TieredCompilation_OnStackReplacement() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_OnStackReplacement; }
+    bool          TieredPGO() const { LIMITED_METHOD_CONTRACT; return fTieredPGO; }
     bool          TieredCompilation_CallCounting()  const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_CallCounting; }
     DWORD         TieredCompilation_CallCountThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountThreshold; }
     DWORD         TieredCompilation_CallCountingDelayMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountingDelayMs; }
+    DWORD         TieredCompilation_BackgroundWorkerCount() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerCount; }
 #endif
 
 #ifndef CROSSGEN_COMPILE
@@ -1019,9 +1022,12 @@ private: //----------------------------------------------------------------
     bool fTieredCompilation;
     bool fTieredCompilation_QuickJit;
     bool fTieredCompilation_QuickJitForLoops;
+    bool fTieredCompilation_OnStackReplacement;
+    bool fTieredPGO;
     bool fTieredCompilation_CallCounting;
     DWORD tieredCompilation_CallCountThreshold;
     DWORD tieredCompilation_CallCountingDelayMs;
+    DWORD tieredCompilation_BackgroundWorkerCount;
 #endif
 
 #ifndef CROSSGEN_COMPILE
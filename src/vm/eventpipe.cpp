@@ -202,9 +202,16 @@ void EventPipe::Initialize()
     // and events so that the EventPipe configuration lock isn't taken at runtime
     InitProvidersAndEvents();
 
-    // Set the sampling rate for the sample profiler.
-    const unsigned long DefaultProfilerSamplingRateInNanoseconds = 1000000; // 1 msec.
-    SampleProfiler::SetSamplingRate(DefaultProfilerSamplingRateInNanoseconds);
+    // Set the sampling rate for the sample profiler. Every sample suspends the runtime, so
+    // allow the interval to be lengthened to reduce the overhead of continuous profiling.
+    DWORD samplingIntervalInMs = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_EventPipeSampleProfilerIntervalMs);
+    // The upper bound keeps the rate in nanoseconds within a 32-bit unsigned long.
+    if (samplingIntervalInMs == 0)
+        samplingIntervalInMs = 1;
+    else if (samplingIntervalInMs > 1000)
+        samplingIntervalInMs = 1000;
+    const unsigned long NumNanosecondsInOneMs = 1000000;
+    SampleProfiler::SetSamplingRate(samplingIntervalInMs * NumNanosecondsInOneMs);
 
     s_tracingInitialized = tracingInitialized;
 }
@@ -66,6 +66,10 @@ bool EventPipeBlock::WriteEvent(EventPipeEventInstance &instance)
         return false;
     }
 
+    // Every event is written with its full header and stack. This layout is part of the
+    // EventBlock format consumed by TraceEvent (see EventPipeFile's serialization version), so
+    // compacting headers or interning stacks here requires a new file format version and a matching
+    // reader; it cannot be changed on the writer side alone.
     BYTE* alignedEnd = m_pWritePointer + totalSize + sizeof(totalSize);
 
     memcpy(m_pWritePointer, &totalSize, sizeof(totalSize));
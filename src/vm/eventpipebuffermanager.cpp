@@ -259,6 +259,12 @@ EventPipeBuffer *EventPipeBufferManager::AllocateBufferForThread(EventPipeSessio
     CONTRACTL_END;
 
     // Allocating a buffer requires us to take the lock.
+    //
+    // This is the only place WriteEvent takes the manager-wide lock. Ordinary writes only take
+    // the writing thread's own EventPipeThread lock, and buffers grow per thread (up to 1MB), so
+    // a busy thread comes here rarely. The buffer is allocated while the lock is held, because
+    // SuspendWriteEvent relies on m_lock to see every buffer list and every in-flight allocation
+    // at once.
     SpinLockHolder _slh(&m_lock);
 
     // if we are deallocating then give up, see the comments in SuspendWriteEvents() for why this is important.
@@ -307,6 +307,8 @@ bool EventPipeSession::WriteEvent(
     CONTRACTL_END;
 
     // Filter events specific to "this" session based on precomputed flag on provider/events.
+    // Each session owns its buffer manager and size limit, so when a slow consumer fills its
+    // buffers, only that session drops events. Other sessions are unaffected.
     return event.IsEnabled(GetId()) ?
         m_pBufferManager->WriteEvent(pThread, *this, event, payload, pActivityId, pRelatedActivityId) :
         false;
@@ -456,6 +458,9 @@ void EventPipeSession::ExecuteRundown()
     if (m_pFile == nullptr)
         return;
 
+    // Rundown runs on the disabling thread with only the EventPipe lock held; it does not suspend the
+    // runtime, so its cost is CPU on this thread proportional to the number of loaded methods. A
+    // trace's stacks can reference any of them, which is why all of them are enumerated.
     if (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_EventPipeRundown) > 0)
     {
         // Ask the runtime to emit rundown events.
@@ -31,6 +31,10 @@ public:
         return m_loggingLevel;
     }
 
+    // The filter data is opaque to the runtime; it is only forwarded to the provider's enable
+    // callback (for example, EventSource command arguments). Events are filtered by keyword and
+    // level only, since native events are written without a payload schema the runtime could
+    // evaluate predicates against.
     LPCWSTR GetFilterData() const
     {
         return m_pFilterData;
@@ -959,7 +959,10 @@ HRESULT ETW::GCLog::ForceGCForDiagnostics()
 #endif // FEATURE_REDHAWK
         
         ForcedGCHolder forcedGCHolder;
-        
+
+        // The heap dump must be blocking: the object and root walks in the GC report the graph as
+        // marked by this GC, and a background GC marks concurrently with mutators, so the edges
+        // it would report could already be stale by the time they are emitted.
         hr = GCHeapUtilities::GetGCHeap()->GarbageCollect(
             -1,     // all generations should be collected
             false,  // low_memory_p
@@ -2752,6 +2755,7 @@ BOOL ETW::TypeSystemLog::s_fHeapAllocEventEnabledOnStartup = FALSE;
 BOOL ETW::TypeSystemLog::s_fHeapAllocHighEventEnabledNow = FALSE;
 BOOL ETW::TypeSystemLog::s_fHeapAllocLowEventEnabledNow = FALSE;
 int ETW::TypeSystemLog::s_nCustomMsBetweenEvents = 0;
+UINT64 ETW::TypeSystemLog::s_allocationSamplingInterval = 100 * 1024;
 
 
 //---------------------------------------------------------------------------------------
@@ -2797,6 +2801,11 @@ void ETW::TypeSystemLog::PostRegistrationInit()
     s_fHeapAllocLowEventEnabledNow = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, TRACE_LEVEL_INFORMATION, CLR_GCHEAPALLOCLOW_KEYWORD);
     s_fHeapAllocHighEventEnabledNow = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, TRACE_LEVEL_INFORMATION, CLR_GCHEAPALLOCHIGH_KEYWORD);
 
+    // The allocation sampling keyword can be turned on at any time, so the interval
+    // is always read (a zero interval is treated as one byte, i.e. sample everything)
+    DWORD dwAllocationSamplingInterval = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_AllocationSamplingInterval);
+    s_allocationSamplingInterval = (dwAllocationSamplingInterval == 0) ? 1 : dwAllocationSamplingInterval;
+
     // Snapshot the current state of the object allocated keyword (on startup), and rely
     // on this snapshot for the rest of the process run. Since these events require the
     // slow alloc JIT helper to be enabled, and that can only be done on startup, we
@@ -2925,6 +2934,143 @@ BOOL ETW::TypeSystemLog::IsHeapAllocEventEnabled()
         (s_fHeapAllocHighEventEnabledNow || s_fHeapAllocLowEventEnabledNow);
 }
 
+//---------------------------------------------------------------------------------------
+//
+// Use this to decide whether to run the allocation sampler. Unlike the
+// GCSampledObjectAllocation events this does not require the slow allocation helper to
+// be forced on at startup, since samples are only taken when an allocation context is
+// refilled, and that always happens on the slow path.
+//
+// Return Value:
+//      nonzero iff the AllocationSampling keyword is enabled.
+//
+
+// static
+BOOL ETW::TypeSystemLog::IsAllocationSamplingEnabled()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, TRACE_LEVEL_INFORMATION, CLR_ALLOCATIONSAMPLING_KEYWORD);
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Draws the distance, in bytes, to the next allocation sample point for the thread.
+// Distances are exponentially distributed around s_allocationSamplingInterval, which
+// makes the sample points a Poisson process over the bytes allocated: every byte has
+// the same chance of being sampled, regardless of how allocation contexts happen to
+// line up with the objects in them.
+//
+// Arguments:
+//      * pThread - Thread whose random state is advanced
+//
+
+// static
+UINT64 ETW::TypeSystemLog::GetNextAllocationSampleDistance(Thread * pThread)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    UINT32 r = pThread->m_allocSampleRandom;
+    if (r == 0)
+    {
+        r = ((UINT32)(size_t)pThread ^ GetTickCount()) | 1;
+    }
+
+    // xorshift32
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+    pThread->m_allocSampleRandom = r;
+
+    // Uniform in (0, 1]
+    double u = ((double)(r >> 8) + 1.0) / (double)(1 << 24);
+    UINT64 distance = (UINT64)(-log(u) * (double)s_allocationSamplingInterval);
+    return (distance == 0) ? 1 : distance;
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Fires the GCAllocationSampled event if the bytes allocated by the current thread have
+// crossed its next sample point. The byte count comes from the thread's allocation
+// context and only moves when the context is refilled, so the object attributed to a
+// sample is the one whose allocation caused the refill; bigger objects are
+// proportionally more likely to be picked. SampleCount reports how many sample points
+// were crossed so that consumers can scale the samples back up to allocated bytes.
+//
+// Arguments:
+//      * pObject - Object that was just allocated
+//
+
+// static
+void ETW::TypeSystemLog::SampleObjectAllocation(Object * pObject)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+        CAN_TAKE_LOCK;
+    }
+    CONTRACTL_END;
+
+    if (!g_fEEStarted || !GCHeapUtilities::UseThreadAllocationContexts())
+        return;
+
+    Thread * pThread = GetThreadNULLOk();
+    if (pThread == NULL)
+        return;
+
+    gc_alloc_context * acontext = pThread->GetAllocContext();
+    UINT64 allocatedBytes = (UINT64)acontext->alloc_bytes + (UINT64)acontext->alloc_bytes_loh;
+
+    if (pThread->m_allocSampleNextBytes == 0)
+    {
+        // First allocation seen since sampling was turned on for this thread; start
+        // counting from here rather than attributing everything before it to this object.
+        pThread->m_allocSampleNextBytes = allocatedBytes + GetNextAllocationSampleDistance(pThread);
+        return;
+    }
+
+    if (allocatedBytes < pThread->m_allocSampleNextBytes)
+        return;
+
+    UINT64 gap = allocatedBytes - pThread->m_allocSampleNextBytes;
+    UINT32 sampleCount;
+    if (gap / s_allocationSamplingInterval >= 64)
+    {
+        // A very large allocation (or a tiny interval); don't walk every sample point.
+        UINT64 expectedCount = gap / s_allocationSamplingInterval + 1;
+        sampleCount = (expectedCount > UINT32_MAX) ? UINT32_MAX : (UINT32)expectedCount;
+        pThread->m_allocSampleNextBytes = allocatedBytes + GetNextAllocationSampleDistance(pThread);
+    }
+    else
+    {
+        sampleCount = 0;
+        do
+        {
+            sampleCount++;
+            pThread->m_allocSampleNextBytes += GetNextAllocationSampleDistance(pThread);
+        }
+        while (allocatedBytes >= pThread->m_allocSampleNextBytes);
+    }
+
+    TypeHandle th = pObject->GetTypeHandle();
+
+    SIZE_T size = pObject->GetSize();
+    if (size < MIN_OBJECT_SIZE)
+    {
+        size = PtrAlign(size);
+    }
+
+    // Make sure the type can be resolved by the consumer
+    LogTypeAndParametersIfNecessary(
+        NULL,
+        th.AsTAddr(),
+        kTypeLogBehaviorTakeLockAndLogIfFirstTime);
+
+    FireEtwGCAllocationSampled(pObject, (LPVOID) th.AsTAddr(), size, sampleCount, s_allocationSamplingInterval, GetClrInstanceId());
+}
+
 //---------------------------------------------------------------------------------------
 //
 // Helper that adds (or updates) the TypeLoggingInfo inside the inner hash table passed
@@ -6239,6 +6385,10 @@ VOID ETW::MethodLog::SendMethodJitStartEvent(MethodDesc *pMethodDesc, SString *n
         szDtraceOutput2 = (PCWSTR)methodName->GetUnicode();
         szDtraceOutput3 = (PCWSTR)methodSignature->GetUnicode();
 
+        // Together with MethodLoadVerbose, which is fired on the same thread once the code is
+        // published and carries the native code size and optimization tier in its flags, this
+        // event brackets each JIT compilation. Consumers derive per-method JIT time from the
+        // timestamps of the pair.
         FireEtwMethodJittingStarted_V1(ullMethodIdentifier, 
                                        ullModuleID, 
                                        ulMethodToken, 
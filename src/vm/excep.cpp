@@ -3537,6 +3537,10 @@ BOOL StackTraceInfo::AppendElement(BOOL bAllowAllocMem, UINT_PTR currentIP, UINT
     if (pFunc != NULL && pFunc->IsILStub())
         return FALSE;
 
+    // Capture is already raw: each element is the IP, SP and MethodDesc that the stack walk has in hand anyway.
+    // No metadata, IL offset or source line lookups happen here; those are done by the managed StackTrace/
+    // StackFrameHelper code only when the trace is actually formatted.
+    //
     // Save this function in the stack trace array, which we only build on the first pass. We'll try to expand the
     // stack trace array if we don't have enough room. Note that we only try to expand if we're allowed to allocate
     // memory (bAllowAllocMem).
@@ -12179,6 +12183,10 @@ void ExceptionNotifications::DeliverFirstChanceNotification()
     // that was thrown or a rethrown exception. We dont want to do this
     // processing for subsequent frames on the stack since FirstChance notification
     // will be delivered only when the exception is first thrown/rethrown.
+    //
+    // Like the ETW ExceptionThrown event (ETW_EVENT_ENABLED) and the debugger/profiler callbacks
+    // (CORDebuggerAttached/CORProfilerTrackExceptions), the check below is a cheap test of whether anyone
+    // subscribed to AppContext.FirstChanceException; no payload is built unless there is a listener.
     ThreadExceptionState *pCurTES = GetThread()->GetExceptionState();
     _ASSERTE(pCurTES->GetCurrentExceptionTracker());
     _ASSERTE(!(pCurTES->GetCurrentExceptionTracker()->DeliveredFirstChanceNotification()));
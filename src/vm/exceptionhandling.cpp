@@ -4556,6 +4556,12 @@ VOID UnwindManagedExceptionPass2(PAL_SEHException& ex, CONTEXT* unwindStartConte
 //                     exception that needs to be dispatched.
 //      frameContext - the context of the first managed frame of the exception call stack
 //
+// Managed frames are unwound with the runtime's own unwinder, using the unwind info found through
+// EECodeInfo, not libunwind. Only native frames go through PAL_VirtualUnwind. The second pass restarts
+// from the same context, so each managed frame is decoded once per pass. Sharing the decoded state
+// between the passes would mean keeping it across the ProcessCLRException callbacks, which re-enter
+// for every frame with their own ExceptionTracker handling.
+//
 VOID DECLSPEC_NORETURN UnwindManagedExceptionPass1(PAL_SEHException& ex, CONTEXT* frameContext)
 {
     CONTEXT unwindStartContext;
@@ -144,6 +144,11 @@ void FinalizerThread::FinalizeAllObjects(int bitToCheck)
 
     Thread *pThread = GetThread();
 
+    // Finalizers are run one at a time on this thread on purpose. User code relies on that:
+    // finalizers that touch shared state without locking, and GC.WaitForPendingFinalizers
+    // waiting for a single thread to drain the queue. The GC hands out critical finalizers
+    // after normal ones from the same queue, so splitting the queue across threads would
+    // also lose that ordering.
     // Finalize everyone
     while (fobj)
     {
@@ -114,13 +114,18 @@ static void ScanStackRoots(Thread * pThread, promote_func* fn, ScanContext* sc)
         {
             Object ** bottomStack = (Object **) pThread->GetCachedStackBase();
             Object ** walk;
+            // The same pointer is often spilled to several adjacent slots. Reporting it again is redundant
+            // since every report is pinned and interior, and each one costs an object lookup in the GC.
+            Object * pLastReported = NULL;
             for (walk = topStack; walk < bottomStack; walk ++)
             {
-                if (((void*)*walk > (void*)bottomStack || (void*)*walk < (void*)topStack) &&
+                if ((*walk != pLastReported) &&
+                    ((void*)*walk > (void*)bottomStack || (void*)*walk < (void*)topStack) &&
                     ((void*)*walk >= (void*)g_lowest_address && (void*)*walk <= (void*)g_highest_address)
                     )
                 {
                     //DbgPrintf("promote " FMT_ADDR " : " FMT_ADDR "\n", walk, *walk);
+                    pLastReported = *walk;
                     fn(walk, sc, GC_CALL_INTERIOR|GC_CALL_PINNED);
                 }
             }
@@ -162,6 +167,10 @@ void GCToEEInterface::GcScanRoots(promote_func* fn, int condemned, int max_gen,
         }
     }
 
+    // Each GC thread walks the whole thread list and scans the stacks of the threads whose allocation
+    // context belongs to its heap, so the partitioning needs no shared state between GC threads. That
+    // matters because the GC scans roots several times per collection (for instance twice for the same
+    // background GC mark), and a claim-based scheme would need a per-scan identity to tell them apart.
     Thread* pThread = NULL;
     while ((pThread = ThreadStore::GetThreadList(pThread)) != NULL)
     {
@@ -1534,3 +1543,39 @@ void GCToEEInterface::UpdateGCEventStatus(int currentPublicLevel, int currentPub
     }
 #endif // __linux__ && FEATURE_EVENT_TRACE
 }
+
+uint32_t GCToEEInterface::GetCapabilityVersion(GCToEECapability capability)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    switch (capability)
+    {
+    case GCToEECapability_NumaTopology:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+bool GCToEEInterface::GetNumaTopology(uint16_t* highestNode)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    assert(highestNode != nullptr);
+
+    // Only report a topology if the EE itself would let the GC be NUMA aware
+    // (GCNumaAware config and more than one node present).
+    if (!NumaNodeInfo::CanEnableGCNumaAware())
+    {
+        return false;
+    }
+
+    ULONG highest = 0;
+    if (!::GetNumaHighestNodeNumber(&highest))
+    {
+        return false;
+    }
+
+    *highestNode = (uint16_t)highest;
+    return true;
+}
@@ -83,6 +83,9 @@ public:
     void VerifySyncTableEntry();
 
     void UpdateGCEventStatus(int publicLevel, int publicKeywords, int privateLevel, int privateKeywords);
+
+    uint32_t GetCapabilityVersion(GCToEECapability capability);
+    bool GetNumaTopology(uint16_t* highestNode);
 };
 
 } // namespace standalone
@@ -814,11 +814,18 @@ void GCToOSInterface::GetMemoryStatus(uint32_t* memory_load, uint64_t* available
         }
 #else
         status = PAL_GetPhysicalMemoryUsed(&workingSetSize);
+
+        // The cgroup gets throttled once it goes over memory.high, so as far as the GC is
+        // concerned that's how much memory there is.
+        uint64_t restricted_high = PAL_GetRestrictedPhysicalMemoryHigh();
+        if ((restricted_high != 0) && (restricted_high < restricted_limit))
+            restricted_limit = restricted_high;
 #endif
         if(status)
         {
             if (memory_load)
-                *memory_load = (uint32_t)((float)workingSetSize * 100.0 / (float)restricted_limit);
+                *memory_load = (workingSetSize >= restricted_limit) ? 100 : 
+                               (uint32_t)((float)workingSetSize * 100.0 / (float)restricted_limit);
             if (available_physical)
             {
                 if(workingSetSize > restricted_limit)
@@ -866,6 +873,28 @@ void GCToOSInterface::GetMemoryStatus(uint32_t* memory_load, uint64_t* available
     }
 }
 
+// Get the memory pressure stall information
+// Parameters:
+//  pressure - The percentage of recent time some threads were stalled waiting for memory
+// Return:
+//  true if the OS reports it, false otherwise.
+bool GCToOSInterface::GetMemoryPressure(uint32_t* pressure)
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifdef FEATURE_PAL
+    UINT stall = 0;
+    if (PAL_GetMemoryPressure(&stall))
+    {
+        *pressure = (uint32_t)stall;
+        return true;
+    }
+#else
+    UNREFERENCED_PARAMETER(pressure);
+#endif
+    return false;
+}
+
 // Get a high precision performance counter
 // Return:
 //  The counter value
@@ -152,6 +152,19 @@ void StashKeywordAndLevel(bool isPublicProvider, GCEventKeyword keywords, GCEven
     }
 }
 
+// Fills in the version of the GC/EE interface this EE was built against. The
+// GC reads it in GC_VersionInfo before writing its own version over it, and uses
+// it to know which of the optional IGCToCLR methods it may call.
+void SetEEVersionInfo(VersionInfo* info)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    info->MajorVersion = GC_INTERFACE_MAJOR_VERSION;
+    info->MinorVersion = GC_INTERFACE_MINOR_VERSION;
+    info->BuildVersion = 0;
+    info->Name = "CoreCLR";
+}
+
 #ifdef FEATURE_STANDALONE_GC
 HMODULE LoadStandaloneGc(LPCWSTR libFileName)
 {
@@ -207,6 +220,7 @@ HRESULT LoadAndInitializeGC(LPWSTR standaloneGcLocation)
     }
 
     g_gc_load_status = GC_LOAD_STATUS_GET_VERSIONINFO;
+    SetEEVersionInfo(&g_gc_version_info);
     versionInfo(&g_gc_version_info);
     g_gc_load_status = GC_LOAD_STATUS_CALL_VERSIONINFO;
 
@@ -264,6 +278,7 @@ HRESULT InitializeDefaultGC()
     LOG((LF_GC, LL_INFO100, "Standalone GC location not provided, using provided GC\n"));
 
     g_gc_load_status = GC_LOAD_STATUS_DONE_LOAD;
+    SetEEVersionInfo(&g_gc_version_info);
     GC_VersionInfo(&g_gc_version_info);
     g_gc_load_status = GC_LOAD_STATUS_CALL_VERSIONINFO;
 
@@ -28,6 +28,10 @@ GVAL_DECL(GCHeapType, g_heap_type);
 extern "C" gc_alloc_context g_global_alloc_context;
 
 extern "C" uint32_t* g_card_bundle_table;
+
+// The write barriers only set a card when the stored reference falls in [g_ephemeral_low, g_ephemeral_high).
+// With segments, gen0 and gen1 share the ephemeral segment, so this range cannot tell a gen1 from a gen0
+// target without a bound that would change (and require stomping the barrier) on every GC.
 extern "C" uint8_t* g_ephemeral_low;
 extern "C" uint8_t* g_ephemeral_high;
 
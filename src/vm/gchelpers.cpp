@@ -580,6 +580,11 @@ OBJECTREF AllocateSzArray(MethodTable* pArrayMT, INT32 cElements, GC_ALLOC_FLAGS
     {
         ETW::TypeSystemLog::SendObjectAllocatedEvent(orArray);
     }
+
+    if (ETW::TypeSystemLog::IsAllocationSamplingEnabled())
+    {
+        ETW::TypeSystemLog::SampleObjectAllocation(orArray);
+    }
 #endif // FEATURE_EVENT_TRACE
 
     return ObjectToOBJECTREF((Object *) orArray);
@@ -821,6 +826,11 @@ OBJECTREF AllocateArrayEx(MethodTable *pArrayMT, INT32 *pArgs, DWORD dwNumArgs,
     {
         ETW::TypeSystemLog::SendObjectAllocatedEvent(orArray);
     }
+
+    if (ETW::TypeSystemLog::IsAllocationSamplingEnabled())
+    {
+        ETW::TypeSystemLog::SampleObjectAllocation(orArray);
+    }
 #endif // FEATURE_EVENT_TRACE
 
     if (kind != ELEMENT_TYPE_ARRAY)
@@ -1018,6 +1028,11 @@ STRINGREF AllocateString( DWORD cchStringLength )
     {
         ETW::TypeSystemLog::SendObjectAllocatedEvent(orObject);
     }
+
+    if (ETW::TypeSystemLog::IsAllocationSamplingEnabled())
+    {
+        ETW::TypeSystemLog::SampleObjectAllocation(orObject);
+    }
 #endif // FEATURE_EVENT_TRACE
 
     LogAlloc(ObjectSize, g_pStringClass, orObject);
@@ -1095,6 +1110,11 @@ UTF8STRINGREF AllocateUtf8String(DWORD cchStringLength)
     {
         ETW::TypeSystemLog::SendObjectAllocatedEvent(orObject);
     }
+
+    if (ETW::TypeSystemLog::IsAllocationSamplingEnabled())
+    {
+        ETW::TypeSystemLog::SampleObjectAllocation(orObject);
+    }
 #endif // FEATURE_EVENT_TRACE
 
     LogAlloc(ObjectSize, g_pUtf8StringClass, orObject);
@@ -1232,6 +1252,11 @@ OBJECTREF AllocateObject(MethodTable *pMT
         {
             ETW::TypeSystemLog::SendObjectAllocatedEvent(orObject);
         }
+
+        if (ETW::TypeSystemLog::IsAllocationSamplingEnabled())
+        {
+            ETW::TypeSystemLog::SampleObjectAllocation(orObject);
+        }
 #endif // FEATURE_EVENT_TRACE
 
         LogAlloc(pMT->GetBaseSize(), pMT, orObject);
@@ -30,6 +30,9 @@
     #endif
 #endif
 
+// Minimum number of cards spanned by a bulk copy before the destination generation is checked
+static const size_t BulkCopyGenerationCheckMinCards = 8;
+
 FORCEINLINE void InlinedSetCardsAfterBulkCopyHelper(Object **start, size_t len)
 {
     // Check whether the writes were even into the heap. If not there's no card update required.
@@ -66,6 +69,16 @@ FORCEINLINE void InlinedSetCardsAfterBulkCopyHelper(Object **start, size_t len)
 
     // calculate the number of clumps to mark (round_up(end) - start)
     size_t clumpCount = endingClump - startingClump;
+
+    // Cards only record references from older generations into younger ones, so a destination that is
+    // still in generation 0 never needs them. Asking the GC costs an interface call, so only do it once
+    // the copy spans enough cards for the saved stores to pay for it.
+    if (clumpCount >= BulkCopyGenerationCheckMinCards &&
+        GCHeapUtilities::GetGCHeap()->WhichGeneration((Object*)start) == 0)
+    {
+        return;
+    }
+
     // VolatileLoadWithoutBarrier() is used here to prevent fetch of g_card_table from being reordered
     // with g_lowest/highest_address check at the beginning of this function.
     uint8_t* card = ((uint8_t*)VolatileLoadWithoutBarrier(&g_card_table)) + startingClump;
@@ -590,6 +590,10 @@ UINT32  GcInfoDecoder::GetSizeOfStackParameterArea()
 #endif // FIXED_STACK_PARAMETER_SCRATCH_AREA
 
 
+// For call sites the cost here is already bounded: FindSafePoint binary searches the fixed-width
+// safepoint offsets, and the live state of a safepoint is located directly (fixed-size bit vectors,
+// or an indirection table into shared RLE vectors) rather than by replaying earlier safepoints. Only
+// fully interruptible code walks the transitions of the chunk containing the offset.
 bool GcInfoDecoder::EnumerateLiveSlots(
                 PREGDISPLAY         pRD,
                 bool                reportScratchSlots,
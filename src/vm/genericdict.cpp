@@ -243,6 +243,12 @@ DictionaryLayout::FindTokenWorker(LoaderAllocator *                 pAllocator,
         // If we've reached the end of the chain we need to allocate another bucket. Make the pointer update carefully to avoid
         // orphaning a bucket in a race. We leak the loser in such a race (since the allocation comes from the loader heap) but both
         // the race and the overflow should be very rare.
+        //
+        // Entries in later buckets never get a dictionary slot: dictionaries are sized from the first bucket when the
+        // instantiation is created and are not reallocated, so lookups for these entries go through JIT_GenericHandle.
+        // Growing the first bucket instead would require reallocating the dictionary of every existing instantiation and
+        // republishing it through the per-instantiation info of the MethodTable or InstantiatedMethodDesc, while jitted
+        // code may be reading the old one.
         if (pDictLayout->m_pNext == NULL)
             FastInterlockCompareExchangePointer(EnsureWritablePages(&(pDictLayout->m_pNext)), Allocate(4, pAllocator, NULL), 0);
 
@@ -2073,6 +2073,10 @@ LocalDesc ILCUTF8Marshaler::GetManagedType()
 	return LocalDesc(ELEMENT_TYPE_STRING);
 }
 
+// For by-value [In] strings the worst-case UTF-8 size is computed up front and, when it fits in
+// MAX_LOCAL_BUFFER_LENGTH, the native buffer is localloc'd so the managed helper transcodes
+// straight into the stack without a heap allocation. Larger strings fall back to a CoTaskMem
+// buffer allocated by the helper; the transcoding itself lives in the managed UTF8Marshaler.
 void ILCUTF8Marshaler::EmitConvertContentsCLRToNative(ILCodeStream* pslILEmit)
 {
 	STANDARD_VM_CONTRACT;
@@ -2071,6 +2071,125 @@ HCIMPLEND_RAW
 //
 //========================================================================
 
+//------------------------------------------------------------------------
+// CastCache: a small, global, direct-mapped cache of the results of
+// TypeHandle::CanCastTo for (source MethodTable, target TypeHandle) pairs.
+// It lets the frameless casting helpers answer casts to variant interfaces,
+// generic interfaces of arrays and similar cases without erecting a frame
+// and walking the interface map again.
+//
+// Lookups take no lock. Each entry has a version that is odd while the entry
+// is being written; a reader only accepts an entry if it observed the same
+// even version before and after reading it. A writer that cannot claim an
+// entry simply drops its update.
+//
+// Types from collectible assemblies are never cached so that an entry can
+// never outlive the types it refers to.
+class CastCache
+{
+    struct Entry
+    {
+        Volatile<LONG>  version;
+        Volatile<TADDR> source;
+        Volatile<TADDR> target;
+        Volatile<BOOL>  result;
+    };
+
+    static const DWORD BucketCount = 1024;
+    static Entry s_entries[BucketCount];
+
+    static Entry* GetEntry(TADDR source, TADDR target)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        DWORD hash = (DWORD)(source >> 3) ^ ((DWORD)(target >> 3) * 31);
+        return &s_entries[hash & (BucketCount - 1)];
+    }
+
+public:
+    // Returns CanCast or CannotCast if the result of pSourceMT->CanCastTo(toTypeHnd) is cached,
+    // and MaybeCast otherwise.
+    static TypeHandle::CastResult TryGet(MethodTable* pSourceMT, TypeHandle toTypeHnd)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        TADDR source = (TADDR)pSourceMT;
+        TADDR target = toTypeHnd.AsTAddr();
+        Entry* pEntry = GetEntry(source, target);
+
+        LONG version = pEntry->version;
+        if ((version & 1) != 0)
+        {
+            return TypeHandle::MaybeCast;
+        }
+
+        if ((pEntry->source != source) || (pEntry->target != target))
+        {
+            return TypeHandle::MaybeCast;
+        }
+
+        BOOL result = pEntry->result;
+        if (pEntry->version != version)
+        {
+            return TypeHandle::MaybeCast;
+        }
+
+        return result ? TypeHandle::CanCast : TypeHandle::CannotCast;
+    }
+
+    static void TrySet(MethodTable* pSourceMT, TypeHandle toTypeHnd, BOOL result)
+    {
+        CONTRACTL {
+            NOTHROW;
+            GC_NOTRIGGER;
+        } CONTRACTL_END;
+
+        if (pSourceMT->Collectible() || toTypeHnd.GetLoaderAllocator()->IsCollectible())
+        {
+            return;
+        }
+
+        TADDR source = (TADDR)pSourceMT;
+        TADDR target = toTypeHnd.AsTAddr();
+        Entry* pEntry = GetEntry(source, target);
+
+        LONG version = pEntry->version;
+        if (((version & 1) != 0) ||
+            (FastInterlockCompareExchange((LONG*)pEntry->version.GetPointer(), version + 1, version) != version))
+        {
+            return;
+        }
+
+        pEntry->source = source;
+        pEntry->target = target;
+        pEntry->result = result;
+        pEntry->version = version + 2;
+    }
+};
+
+CastCache::Entry CastCache::s_entries[CastCache::BucketCount];
+
+// Consults the cast cache for a cast that the frameless checks could not decide. A cached
+// negative result only covers TypeHandle::CanCastTo, so it is ignored for the cases where
+// ObjIsInstanceOf has further checks: Nullable targets, and interface targets of COM
+// objects and ICastable objects.
+static TypeHandle::CastResult ObjIsInstanceOfCached(Object *pObject, TypeHandle toTypeHnd)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    MethodTable *pMT = pObject->GetMethodTable();
+    TypeHandle::CastResult result = CastCache::TryGet(pMT, toTypeHnd);
+
+    if ((result == TypeHandle::CannotCast) &&
+        (Nullable::IsNullableType(toTypeHnd) ||
+         (toTypeHnd.IsInterface() && (pMT->IsComObjectType() || pMT->IsICastable()))))
+    {
+        return TypeHandle::MaybeCast;
+    }
+
+    return result;
+}
+
 // pObject MUST be an instance of an array.
 TypeHandle::CastResult ArrayIsInstanceOfNoGC(Object *pObject, TypeHandle toTypeHnd)
 {
@@ -2226,7 +2345,15 @@ BOOL ObjIsInstanceOf(Object *pObject, TypeHandle toTypeHnd, BOOL throwCastExcept
     // services which will determine whether the proxy and the type are compatible.
     // Start by doing a quick static cast check to see if the type information captured in
     // the metadata indicates that the cast is legal.
-    if (fromTypeHnd.CanCastTo(toTypeHnd))
+    TypeHandle::CastResult staticCastResult = CastCache::TryGet(obj->GetMethodTable(), toTypeHnd);
+    if (staticCastResult == TypeHandle::MaybeCast)
+    {
+        BOOL canCast = fromTypeHnd.CanCastTo(toTypeHnd);
+        CastCache::TrySet(obj->GetMethodTable(), toTypeHnd, canCast);
+        staticCastResult = canCast ? TypeHandle::CanCast : TypeHandle::CannotCast;
+    }
+
+    if (staticCastResult == TypeHandle::CanCast)
     {
         fCast = TRUE;
     }
@@ -2509,7 +2636,13 @@ HCIMPL2(Object *, JIT_IsInstanceOfAny, CORINFO_CLASS_HANDLE type, Object* obj)
         return NULL;
     }
 
-    switch (ObjIsInstanceOfNoGC(obj, TypeHandle(type))) {
+    TypeHandle::CastResult result = ObjIsInstanceOfNoGC(obj, TypeHandle(type));
+    if (result == TypeHandle::MaybeCast)
+    {
+        result = ObjIsInstanceOfCached(obj, TypeHandle(type));
+    }
+
+    switch (result) {
     case TypeHandle::CanCast:
         return obj;
     case TypeHandle::CannotCast:
@@ -2543,6 +2676,11 @@ HCIMPL2(Object *, JIT_ChkCastAny, CORINFO_CLASS_HANDLE type, Object *obj)
         return obj;
     }
 
+    if ((result == TypeHandle::MaybeCast) && (ObjIsInstanceOfCached(obj, TypeHandle(type)) == TypeHandle::CanCast))
+    {
+        return obj;
+    }
+
     ENDFORBIDGC();
     Object* pRet = HCCALL2(JITutil_ChkCastAny, type, obj);
     // Make sure that the fast helper have not lied
@@ -2569,6 +2707,16 @@ NOINLINE HCIMPL2(Object *, JITutil_IsInstanceOfInterface, MethodTable *pInterfac
         }
     }
 
+    switch (ObjIsInstanceOfCached(obj, TypeHandle(pInterfaceMT))) {
+    case TypeHandle::CanCast:
+        return obj;
+    case TypeHandle::CannotCast:
+        return NULL;
+    default:
+        // fall through to the slow helper
+        break;
+    }
+
     ENDFORBIDGC();
     return HCCALL2(JITutil_IsInstanceOfAny, CORINFO_CLASS_HANDLE(pInterfaceMT), obj);
 
@@ -2587,6 +2735,11 @@ NOINLINE HCIMPL2(Object *, JITutil_ChkCastInterface, MethodTable *pInterfaceMT,
         }
     }
 
+    if (ObjIsInstanceOfCached(obj, TypeHandle(pInterfaceMT)) == TypeHandle::CanCast)
+    {
+        return obj;
+    }
+
     ENDFORBIDGC();
     return HCCALL2(JITutil_ChkCastAny, CORINFO_CLASS_HANDLE(pInterfaceMT), obj);
 }
@@ -2656,6 +2809,10 @@ HCIMPLEND
 //*************************************************************
 // Allocation fast path for typical objects
 //
+// The JIT always calls this through CORINFO_HELP_NEWSFAST rather than expanding the bump inline.
+// Inlining it would make the alloc_ptr/alloc_limit layout and the Thread TLS offset part of the
+// JIT-EE contract and would grow every allocation site, so it stays behind the helper.
+//
 HCIMPL1(Object*, JIT_NewS_MP_FastPortable, CORINFO_CLASS_HANDLE typeHnd_)
 {
     FCALL_CONTRACT;
@@ -2968,6 +3125,10 @@ HCIMPLEND
 //*************************************************************
 // Array allocation fast path for arrays of value type elements
 //
+// On Unix GetThread() reads gCurrentThreadInfo directly through __thread, so the portable helper
+// already accesses the allocation context inline; the remaining difference from the Windows
+// assembly helpers is the prolog/epilog the C++ compiler generates around the fast path.
+//
 HCIMPL2(Object*, JIT_NewArr1VC_MP_FastPortable, CORINFO_CLASS_HANDLE arrayMT, INT_PTR size)
 {
     FCALL_CONTRACT;
@@ -5385,6 +5546,102 @@ HCIMPL1(void, JIT_LogMethodEnter, CORINFO_METHOD_HANDLE methHnd_)
 
 HCIMPLEND
 
+//========================================================================
+//
+//      TIERED COMPILATION HELPERS
+//
+//========================================================================
+
+// Called by tier-0 code when the counter of a loop patchpoint runs out (see
+// Compiler::fgInsertPatchpoints). The method is handed to the tiered compilation
+// manager for promotion so that later calls run optimized code; the frame that hit
+// the patchpoint keeps running its tier-0 code. Returns the value the patchpoint
+// counter is reloaded with.
+HCIMPL2(INT32, JIT_Patchpoint, CORINFO_METHOD_HANDLE methHnd_, INT32 ilOffset)
+{
+    FCALL_CONTRACT;
+
+    // Once the method has been handed off there is nothing more this frame can do,
+    // so push the next patchpoint call out of reach.
+    INT32 nextCounter = INT32_MAX;
+
+#ifdef FEATURE_TIERED_COMPILATION
+    MethodDesc* pMD = GetMethod(methHnd_);
+
+    HELPER_METHOD_FRAME_BEGIN_RET_0();
+
+    if (g_pConfig->TieredCompilation_OnStackReplacement() && pMD->IsEligibleForTieredCompilation())
+    {
+        LOG((LF_TIEREDCOMPILATION, LL_INFO10000, "JIT_Patchpoint Method=0x%pM (%s::%s) ILOffset=0x%x\n",
+            pMD, pMD->m_pszDebugClassName, pMD->m_pszDebugMethodName, ilOffset));
+
+        GCX_PREEMP();
+        EX_TRY
+        {
+            GetAppDomain()->GetTieredCompilationManager()->AsyncPromoteMethodToTier1(pMD);
+        }
+        EX_CATCH
+        {
+            // Failing to promote only costs throughput, keep running tier-0 code
+        }
+        EX_END_CATCH(RethrowTerminalExceptions);
+    }
+
+    HELPER_METHOD_FRAME_END();
+#endif // FEATURE_TIERED_COMPILATION
+
+    return nextCounter;
+}
+HCIMPLEND
+
+// Called by instrumented tier-0 code before a virtual call, to record the class of
+// the 'this' object. The table keeps a reservoir sample of the classes seen, from
+// which the tier 1 jit picks the classes to guess for in guarded devirtualization.
+// Updates are not synchronized; losing a sample now and then does not matter.
+HCIMPL2(void, JIT_ClassProfile, Object *obj, ICorJitInfo::ClassProfile* classProfile)
+{
+    FCALL_CONTRACT;
+
+    OBJECTREF objRef = ObjectToOBJECTREF(obj);
+    if (objRef == NULL)
+    {
+        // The call itself will throw
+        return;
+    }
+
+    MethodTable* pMT = objRef->GetMethodTable();
+
+    // The tier 1 jit may embed the class handle in its code, so the class must
+    // outlive the method; skip classes that could be unloaded first.
+    if (pMT->Collectible())
+    {
+        return;
+    }
+
+    const UINT32 count = classProfile->Count++;
+
+    if (count < ICorJitInfo::ClassProfile::SIZE)
+    {
+        classProfile->ClassTable[count] = (CORINFO_CLASS_HANDLE)pMT;
+        return;
+    }
+
+    // Keep each class seen so far with equal probability
+    static UINT32 s_random = 0x2545f491;
+    UINT32 x = s_random;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    s_random = x;
+
+    const UINT32 index = x % count;
+    if (index < ICorJitInfo::ClassProfile::SIZE)
+    {
+        classProfile->ClassTable[index] = (CORINFO_CLASS_HANDLE)pMT;
+    }
+}
+HCIMPLEND
+
 
 
 //========================================================================
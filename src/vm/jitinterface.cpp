@@ -1576,6 +1576,10 @@ void CEEInfo::getFieldInfo (CORINFO_RESOLVED_TOKEN * pResolvedToken,
                 fieldAccessor = CORINFO_FIELD_STATIC_ADDRESS;
 
                 // We are not going through a helper. The constructor has to be triggered explicitly.
+                // The JIT asks initClass about this, which answers CORINFO_INITCLASS_INITIALIZED
+                // once the class has been initialized. Code jitted after that point, which is
+                // the common case for tier-1 rejits, therefore embeds the static address with
+                // no init check at all.
                 if (!pFieldMT->IsClassPreInited())
                     fieldFlags |= CORINFO_FLG_FIELD_INITCLASS;
             }
@@ -9973,6 +9977,9 @@ BOOL NDirectMethodDesc::ComputeMarshalingRequired()
 }
 
 /*********************************************************************/
+// Note that a FALSE result only lets the JIT inline the transition; the call still switches to
+// preemptive mode and polls for a pending suspension on return. There is no mode in which a
+// P/Invoke is made while staying in cooperative mode.
 BOOL CEEInfo::pInvokeMarshalingRequired(CORINFO_METHOD_HANDLE method, CORINFO_SIG_INFO* callSiteSig)
 {
     CONTRACTL {
@@ -11088,6 +11095,9 @@ void CEEJitInfo::GetProfilingHandle(BOOL                      *pbHookFunction,
         // We pass in the typical method definition to the function mapper because in
         // Whidbey all the profiling API transactions are done in terms of typical
         // method definitions not instantiations.
+        //
+        // This is the per-method opt-out for ELT: when the profiler's mapper clears
+        // bHookFunction, the JIT emits no enter/leave/tailcall probe for the method at all.
         BOOL bHookFunction = TRUE;
         void * profilerHandle = m_pMethodBeingCompiled;
 
@@ -11980,7 +11990,7 @@ HRESULT CEEJitInfo::allocMethodBlockCounts (
 
     JIT_TO_EE_TRANSITION();
 
-#ifdef FEATURE_PREJIT
+#if defined(FEATURE_PREJIT) || defined(FEATURE_TIERED_COMPILATION)
 
     // We need to know the code size. Typically we can get the code size
     // from m_ILHeader. For dynamic methods, m_ILHeader will be NULL, so
@@ -11998,21 +12008,38 @@ HRESULT CEEJitInfo::allocMethodBlockCounts (
     {
         codeSize = m_ILHeader->GetCodeSize();    
     }
-    
-    *pBlockCounts = m_pMethodBeingCompiled->GetLoaderModule()->AllocateMethodBlockCounts(m_pMethodBeingCompiled->GetMemberDef(), count, codeSize);
-    hr = (*pBlockCounts != nullptr) ? S_OK : E_OUTOFMEMORY;
+
+#ifdef FEATURE_TIERED_COMPILATION
+    // Instrumented tier-0 code keeps its counts for the tier 1 compilation
+    if (g_pConfig->TieredPGO() && m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0))
+    {
+        *pBlockCounts = GetAppDomain()->GetTieredCompilationManager()->AllocateMethodBlockCounts(m_pMethodBeingCompiled, count, codeSize);
+        hr = (*pBlockCounts != nullptr) ? S_OK : E_OUTOFMEMORY;
+    }
+    else
+#endif // FEATURE_TIERED_COMPILATION
+    {
+#ifdef FEATURE_PREJIT
+        *pBlockCounts = m_pMethodBeingCompiled->GetLoaderModule()->AllocateMethodBlockCounts(m_pMethodBeingCompiled->GetMemberDef(), count, codeSize);
+        hr = (*pBlockCounts != nullptr) ? S_OK : E_OUTOFMEMORY;
 #else // FEATURE_PREJIT
+        _ASSERTE(!"allocMethodBlockCounts not implemented on CEEJitInfo!");
+        hr = E_NOTIMPL;
+#endif // !FEATURE_PREJIT
+    }
+#else // FEATURE_PREJIT || FEATURE_TIERED_COMPILATION
     _ASSERTE(!"allocMethodBlockCounts not implemented on CEEJitInfo!");
     hr = E_NOTIMPL;
-#endif // !FEATURE_PREJIT
+#endif // !(FEATURE_PREJIT || FEATURE_TIERED_COMPILATION)
 
     EE_TO_JIT_TRANSITION();
     
     return hr;
 }
 
-// Consider implementing getBBProfileData on CEEJitInfo.  This will allow us
-// to use profile info in codegen for non zapped images.
+// Returns the block counts recorded by the method's instrumented tier-0 code, for
+// use by the tier 1 compilation. Profile data for non zapped images is otherwise
+// not available.
 HRESULT CEEJitInfo::getMethodBlockCounts (
     CORINFO_METHOD_HANDLE         ftnHnd,
     UINT32 *                      pCount,          // pointer to the count of <ILOffset, ExecutionCount> tuples
@@ -12020,9 +12047,36 @@ HRESULT CEEJitInfo::getMethodBlockCounts (
     UINT32 *                      pNumRuns
     )
 {
-    LIMITED_METHOD_CONTRACT;
-    _ASSERTE(!"getMethodBlockCounts not implemented on CEEJitInfo!");
-    return E_NOTIMPL;
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    } CONTRACTL_END;
+
+    HRESULT hr = E_FAIL;
+    *pCount = 0;
+    *pBlockCounts = nullptr;
+    *pNumRuns = 0;
+
+    JIT_TO_EE_TRANSITION_LEAF();
+
+#ifdef FEATURE_TIERED_COMPILATION
+    MethodDesc * pMD = GetMethod(ftnHnd);
+    UINT32 ilSize = 0;
+    if (g_pConfig->TieredPGO() &&
+        (pMD == m_pMethodBeingCompiled) &&
+        GetAppDomain()->GetTieredCompilationManager()->GetMethodBlockCounts(pMD, pCount, pBlockCounts, &ilSize))
+    {
+        // A failed result with non-NULL counts tells the JIT the IL no longer matches
+        // the IL the counts were recorded against (e.g. after a rejit).
+        hr = ((m_ILHeader != NULL) && (m_ILHeader->GetCodeSize() == ilSize)) ? S_OK : E_FAIL;
+        *pNumRuns = 1;
+    }
+#endif // FEATURE_TIERED_COMPILATION
+
+    EE_TO_JIT_TRANSITION_LEAF();
+
+    return hr;
 }
 
 void CEEJitInfo::allocMem (
@@ -12044,6 +12098,10 @@ void CEEJitInfo::allocMem (
 
     JIT_TO_EE_TRANSITION();
 
+    // The JIT only splits methods when JIT_FLAG_PROCSPLIT is passed, which only the zapper does.
+    // Jitted code is described by a single CodeHeader / RealCodeHeader range: EECodeInfo, the
+    // nibble map, unwind info registration and GC info lookup all assume that, so supporting a
+    // separate cold region here would have to start with those.
     _ASSERTE(coldCodeSize == 0);
     if (coldCodeBlock)
     {
@@ -12641,7 +12699,16 @@ CORJIT_FLAGS GetDebuggerCompileFlags(Module* pModule, CORJIT_FLAGS flags)
 
     if (CORDisableJITOptimizations(pModule->GetDebuggerInfoBits()))
     {
-        flags.Set(CORJIT_FLAGS::CORJIT_FLAG_DEBUG_CODE);
+        // An attached debugger typically turns optimizations off for every module it sees load, which
+        // changes the performance of the process being investigated. DbgKeepJITOptimizations lets the
+        // code stay optimized (debug info is still tracked above) as long as EnC does not need it to be
+        // debuggable.
+        static ConfigDWORD s_keepJITOptimizations;
+        if (s_keepJITOptimizations.val(CLRConfig::UNSUPPORTED_DbgKeepJITOptimizations) == 0 ||
+            flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_DEBUG_EnC))
+        {
+            flags.Set(CORJIT_FLAGS::CORJIT_FLAG_DEBUG_CODE);
+        }
     }
 
     if (flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_IMPORT_ONLY))
@@ -13889,6 +13956,11 @@ void* CEEInfo::getTailCallCopyArgsThunk(CORINFO_SIG_INFO       *pSig,
 
     void * ftn = NULL;
 
+    // The copy-args thunks feed JIT_TailCall, which relies on the TailCallFrame and on
+    // Windows-specific stack unwinding. On other platforms no thunk is returned and the
+    // JIT turns explicit tail calls that cannot be fast tail calls into regular calls,
+    // so deeply mutually recursive tail-calling code can overflow the stack there.
+    // Honoring them everywhere needs a different, portable helper mechanism.
 #if (defined(_TARGET_AMD64_) || defined(_TARGET_ARM_)) && !defined(FEATURE_PAL)
 
     JIT_TO_EE_TRANSITION();
@@ -10518,6 +10518,13 @@ MethodTableBuilder::SetupMethodTable2(
         {
             // Make sure that temporary entrypoints are create for methods. NGEN uses temporary
             // entrypoints as surrogate keys for precodes.
+            //
+            // These cannot be created lazily on first call: the vtable slots filled in below, the
+            // non-virtual slots and any delegate or ldftn target all hold the temporary entrypoint
+            // directly, so it has to be a callable address before the type is published. The
+            // precodes for a chunk come from a single precode heap allocation (or compact entrypoints
+            // where HAS_COMPACT_ENTRYPOINTS is defined), which keeps the per-method cost to the
+            // size of one precode.
             pChunk->EnsureTemporaryEntryPointsCreated(GetLoaderAllocator(), GetMemTracker());
         }
     }
@@ -11700,6 +11707,11 @@ BOOL MethodTableBuilder::bmtMethodImplInfo::IsBody(mdToken tok)
 }
 
 //*******************************************************************************
+// Type loading splits its allocations between the two loader heaps of the LoaderAllocator.
+// MethodTables, MethodDescChunks, FieldDescs and dispatch maps, which are touched while running
+// code and jitting, come from the high frequency heap. The EEClass, its optional fields, debug
+// names and other data that is mostly read during type loading come from the low frequency
+// heap, which keeps it off the pages that hold the hot runtime structures.
 BYTE *
 MethodTableBuilder::AllocateFromHighFrequencyHeap(S_SIZE_T cbMem)
 {
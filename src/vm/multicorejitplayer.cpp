@@ -555,6 +555,12 @@ bool MulticoreJitProfilePlayer::CompileMethodDesc(Module * pModule, MethodDesc *
 
 
 // Conditional JIT of a method
+//
+// Resolving the MethodDesc and jitting it on the player thread also loads its owning type, the typical
+// shared instantiation and the types its IL references, so type loading for recorded methods already
+// moves to the background. Types that are only loaded by startup code that is never jitted (e.g. R2R
+// code) are not recorded; doing so would need a new record kind in the profile format (see
+// multicorejitimpl.h) and a hook in ClassLoader to record type loads.
 void MulticoreJitProfilePlayer::JITMethod(Module * pModule, unsigned methodIndex)
 {
     STANDARD_VM_CONTRACT;
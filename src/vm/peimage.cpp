@@ -1378,6 +1378,9 @@ HANDLE PEImage::GetFileHandle()
     if (m_hFile!=INVALID_HANDLE_VALUE)
         return m_hFile;
 
+    // Every layout is built from a handle to a whole file at m_path; images always start at file
+    // offset 0. Loading from inside a bundle would need an (offset, size) carried through here and
+    // through the PAL's PE mapping, which assumes the PE headers are at the start of the handle.
     {
         ErrorModeHolder mode(SEM_NOOPENFILEERRORBOX|SEM_FAILCRITICALERRORS);
         m_hFile=WszCreateFile((LPCWSTR) m_path,
@@ -138,6 +138,9 @@ void PerfMap::WriteLine(SString& line)
     {
         // Write the line.
         // The PAL already takes a lock when writing, so we don't need to do so here.
+        // Lines are not buffered in-process on purpose: perf may read the map while the process is
+        // still running (e.g. perf record -p), and a method that is JIT'd just before the process
+        // goes quiet must already be in the file at that point.
         StackScratchBuffer scratch;
         const char * strLine = line.GetANSI(scratch);
         ULONG inCount = line.GetCount();
@@ -13,6 +13,10 @@
 class PerfInfo;
 
 // Generates a perfmap file.
+//
+// The map is append-only: code that is unloaded (collectible assemblies) or replaced (tier-0
+// code superseded by tier-1) is never removed, and its address range may later be reused by
+// new code. Consumers should resolve an address using the last entry that covers it.
 class PerfMap
 {
 private:
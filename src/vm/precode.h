@@ -31,6 +31,11 @@ enum PrecodeType {
 };
 
 // For more details see. file:../../doc/BookOfTheRuntime/ClassLoader/MethodDescDesign.doc
+//
+// Precodes embed their target and MethodDesc pointers in the instruction stream, so backpatching a
+// precode writes to the code page itself. Callers of SetTargetInterlocked/ResetTargetInterlocked rely
+// on the instruction bytes and the data sharing one allocation, and on the FixupPrecode chunk layout
+// that places the MethodDesc base after the precodes.
 class Precode {
 #ifdef DACCESS_COMPILE
     friend class NativeImageDumper;
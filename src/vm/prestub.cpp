@@ -526,6 +526,22 @@ PCODE MethodDesc::GetPrecompiledR2RCode(PrepareCodeConfig* pConfig)
     {
         pCode = pModule->GetReadyToRunInfo()->GetEntryPoint(this, pConfig, TRUE /* fFixups */);
     }
+
+    // With the large version bubble enabled, instantiations of generic code from other assemblies in the bubble
+    // (e.g. framework collections over application types) are compiled into the image of the assembly that uses
+    // them. Look for them in the entry point assembly's image.
+    if ((pCode == NULL) && HasClassOrMethodInstantiation())
+    {
+        Assembly * pRootAssembly = GetAppDomain()->GetRootAssembly();
+        if (pRootAssembly != NULL)
+        {
+            Module * pRootModule = pRootAssembly->GetManifestModule();
+            if ((pRootModule != pModule) && pRootModule->IsReadyToRun() && pRootModule->IsInSameVersionBubble(pModule))
+            {
+                pCode = pRootModule->GetReadyToRunInfo()->GetEntryPoint(this, pConfig, TRUE /* fFixups */);
+            }
+        }
+    }
 #endif
     return pCode;
 }
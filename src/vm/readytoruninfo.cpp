@@ -681,6 +681,9 @@ static bool SigMatchesMethodDesc(MethodDesc* pMD, SigPointer &sig, Module * pMod
     return true;
 }
 
+// Each method has at most one entry in the method tables of the image, so there is no way to select
+// between code variants compiled for different instruction sets here. Methods whose code depends on
+// the target's SIMD width are not compiled by crossgen and are left to the JIT at runtime.
 PCODE ReadyToRunInfo::GetEntryPoint(MethodDesc * pMD, PrepareCodeConfig* pConfig, BOOL fFixups)
 {
     STANDARD_VM_CONTRACT;
@@ -155,12 +155,34 @@ FCIMPL5(Object*, RuntimeFieldHandle::GetValue, ReflectFieldObject *pFieldUNSAFE,
 
     TypeHandle fieldType = gc.pFieldType->GetType();
     TypeHandle declaringType = (gc.pDeclaringType != NULL) ? gc.pDeclaringType->GetType() : TypeHandle();
-    
+
+    // Fast path for repeated reads of an object reference instance field of a
+    // reference type. Once the managed side has cached *pDomainInitialized the
+    // class is known to be initialized, and reading the reference neither
+    // allocates nor triggers a GC, so there is no need to erect a frame and go
+    // through InvokeUtil::GetFieldValue. The target has already been checked
+    // against the declaring type by the managed caller.
+    FieldDesc *pField = gc.refField->GetField();
+    if (*pDomainInitialized == TRUE &&
+        gc.target != NULL &&
+        !declaringType.IsNull() &&
+        !pField->IsStatic() &&
+        !pField->IsEnCNew() &&
+        pField->IsObjRef())
+    {
+        MethodTable *pDeclMT = declaringType.GetMethodTable();
+        if (!pDeclMT->IsValueType() && !pDeclMT->IsSharedByGenericInstantiations())
+        {
+            Object **pRef = (Object **)pField->GetAddressNoThrowNoGC(OBJECTREFToObject(gc.target));
+            return VolatileLoad(pRef);
+        }
+    }
+
     Assembly *pAssem;
     if (declaringType.IsNull())
     {
         // global field
-        pAssem = gc.refField->GetField()->GetModule()->GetAssembly();
+        pAssem = pField->GetModule()->GetAssembly();
     }
     else
     {
@@ -963,6 +985,11 @@ void DECLSPEC_NORETURN ThrowInvokeMethodException(MethodDesc * pMethod, OBJECTRE
     GCPROTECT_END();
 }
 
+// Every call builds the argument frame from the signature with ArgIteratorForMethodInvoke and
+// calls the target through CallDescrWorker. Argument coercion and validation happen in managed
+// code (RuntimeType.CheckArguments) before this is reached. A per-MethodDesc IL invoke stub
+// would replace both, but it needs a new ILStubCache stub kind together with the managed side
+// that decides when a target is hot enough to pay for generating it.
 FCIMPL5(Object*, RuntimeMethodHandle::InvokeMethod,
     Object *target, PTRArray *objs, SignatureNative* pSigUNSAFE,
     CLR_BOOL fConstructor, CLR_BOOL fWrapExceptions)
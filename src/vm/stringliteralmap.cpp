@@ -488,6 +488,15 @@ StringLiteralEntry *GlobalStringLiteralMap::AddStringLiteral(EEStringData *pStri
     StringLiteralEntry *pRet;
 
     {
+    // PERF: Each literal costs a GC heap string plus a slot in the large heap
+    // handle table, and jitted code reaches it through that slot
+    // (constructStringLiteral returns IAT_PVALUE). The JIT already accepts
+    // IAT_VALUE for literals, so strings allocated on a segment registered
+    // through IGCHeap::RegisterFrozenSegment could be embedded by address.
+    // That is not done because the GC interface here can only register a
+    // segment with a fixed allocated range, and it cannot grow one after the
+    // fact. Literals are created lazily as methods are jitted, so that is not
+    // enough.
     LargeHeapHandleBlockHolder pStrObj(&m_LargeHeapHandleTable,1);
     // Create the COM+ string object.
     STRINGREF strObj = AllocateStringObject(pStringData);
@@ -928,6 +928,12 @@ DWORD SyncBlockCache::NewSyncBlockSlot(Object *obj)
     CONTRACTL_END;
     _ASSERTE(m_CacheLock.OwnedByCurrentThread()); // GetSyncBlock takes the lock, make sure no one else does.  
 
+    // PERF: Slot and SyncBlock allocation are serialized on m_CacheLock, but most
+    // objects never get here. Uncontended locks use the thin lock in the object
+    // header, and hash codes are kept in the header bits too. A sync block is only
+    // created for contention, waits, COM data, or a hash code combined with a lock.
+    // Slot reclamation during GC (GCWeakPtrScan) relies on the single free list
+    // and the single table, which is why neither is split per CPU.
     DWORD indexNewEntry;
     if (m_FreeSyncTableList)
     {
@@ -1623,15 +1629,17 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 return result;
             }
 
+            // Only spin as long as spinning has recently been paying off for this lock
+            const DWORD lockSpinCount = awareLock->GetAdaptiveSpinCount(spinCount);
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < lockSpinCount)
             {
                 while (true)
                 {
                     AwareLock::SpinWait(normalizationInfo, spinIteration);
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= lockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1640,6 +1648,7 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult_Entered)
                     {
+                        awareLock->RecordSpinResult(true);
                         return AwareLock::EnterHelperResult_Entered;
                     }
                     if (result == AwareLock::EnterHelperResult_UseSlowPath)
@@ -1651,8 +1660,10 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
 
             if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
             {
+                awareLock->RecordSpinResult(true);
                 return AwareLock::EnterHelperResult_Entered;
             }
+            awareLock->RecordSpinResult(false);
             break;
         }
 
@@ -2410,6 +2421,7 @@ void AwareLock::Enter()
         {
             // We get here if we successfully acquired the mutex.
             m_HoldingThread = pCurThread;
+            m_HoldingOSThreadId = pCurThread->GetOSThreadId();
             m_Recursion = 1;
             pCurThread->IncLockCount();
 
@@ -2473,6 +2485,7 @@ BOOL AwareLock::TryEnter(INT32 timeOut)
         {
             // We get here if we successfully acquired the mutex.
             m_HoldingThread = pCurThread;
+            m_HoldingOSThreadId = pCurThread->GetOSThreadId();
             m_Recursion = 1;
             pCurThread->IncLockCount();
 
@@ -2588,8 +2601,17 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
     {
         QueryPerformanceCounter(&startTicks);
 
-        // Fire a contention start event for a managed contention
-        FireEtwContentionStart_V1(ETW::ContentionLog::ContentionStructs::ManagedContention, GetClrInstanceId());
+        // Fire a contention start event for a managed contention. The owner is read without synchronization and
+        // may already have released the lock, in which case it is 0. The ID is stored in the lock rather than read
+        // from the holding thread so that a thread that has since exited is never touched.
+        UINT64 lockOwnerThreadId = (UINT64)VolatileLoadWithoutBarrier(&m_HoldingOSThreadId);
+
+        FireEtwContentionStart_V2(
+            ETW::ContentionLog::ContentionStructs::ManagedContention,
+            GetClrInstanceId(),
+            this,
+            OBJECTREFToObject(GetOwningObject()),
+            lockOwnerThreadId);
     }
 
     LogContention();
@@ -2740,6 +2762,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
     }
 
     m_HoldingThread = pCurThread;
+    m_HoldingOSThreadId = pCurThread->GetOSThreadId();
     m_Recursion = 1;
     pCurThread->IncLockCount();
 
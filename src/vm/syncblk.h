@@ -442,6 +442,9 @@ private:
 
     ULONG           m_Recursion;
     PTR_Thread      m_HoldingThread;
+    // OS thread ID of m_HoldingThread, so that it can be reported for a contending waiter without
+    // touching the holding thread, which may have released the lock and exited by then
+    DWORD           m_HoldingOSThreadId;
 
     LONG            m_TransientPrecious;
 
@@ -454,7 +457,13 @@ private:
 
     DWORD m_waiterStarvationStartTimeMs;
 
+    // The monitor spin count is shifted right by this amount when spinning on this lock. It goes up when a spin fails to
+    // acquire the lock and down when a spin succeeds, so that locks that are typically held for longer than a spin stop
+    // wasting CPU time before waiting, while locks with short hold times keep spinning.
+    BYTE m_spinCountShift;
+
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
+    static const BYTE MaxSpinCountShift = 4;
 
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
     AwareLock(DWORD indx)
@@ -463,9 +472,11 @@ private:
 // PreFAST has trouble with intializing a NULL PTR_Thread.
           m_HoldingThread(NULL),
 #endif // DACCESS_COMPILE          
+          m_HoldingOSThreadId(0),
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
-          m_waiterStarvationStartTimeMs(0)
+          m_waiterStarvationStartTimeMs(0),
+          m_spinCountShift(0)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -530,6 +541,10 @@ private:
     void RecordWaiterStarvationStartTime();
     bool ShouldStopPreemptingWaiters() const;
 
+public:
+    DWORD GetAdaptiveSpinCount(DWORD maxSpinCount) const;
+    void RecordSpinResult(bool acquiredLock);
+
 private: // friend access is required for this unsafe function
     void InitializeToLockedWithNoWaiters(ULONG recursionLevel, PTR_Thread holdingThread)
     {
@@ -538,6 +553,7 @@ private: // friend access is required for this unsafe function
         m_lockState.InitializeToLockedWithNoWaiters();
         m_Recursion = recursionLevel;
         m_HoldingThread = holdingThread;
+        m_HoldingOSThreadId = holdingThread->GetOSThreadId();
     }
 
 public:
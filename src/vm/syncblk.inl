@@ -458,6 +458,31 @@ FORCEINLINE bool AwareLock::ShouldStopPreemptingWaiters() const
         GetTickCount() - waiterStarvationStartTimeMs >= WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters;
 }
 
+FORCEINLINE DWORD AwareLock::GetAdaptiveSpinCount(DWORD maxSpinCount) const
+{
+    LIMITED_METHOD_CONTRACT;
+    return maxSpinCount >> VolatileLoadWithoutBarrier(&m_spinCountShift);
+}
+
+FORCEINLINE void AwareLock::RecordSpinResult(bool acquiredLock)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Updates may race with other spinners, which is fine since this is only a heuristic
+    BYTE spinCountShift = VolatileLoadWithoutBarrier(&m_spinCountShift);
+    if (acquiredLock)
+    {
+        if (spinCountShift != 0)
+        {
+            VolatileStoreWithoutBarrier(&m_spinCountShift, (BYTE)(spinCountShift - 1));
+        }
+    }
+    else if (spinCountShift < MaxSpinCountShift)
+    {
+        VolatileStoreWithoutBarrier(&m_spinCountShift, (BYTE)(spinCountShift + 1));
+    }
+}
+
 FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration)
 {
     WRAPPER_NO_CONTRACT;
@@ -479,6 +504,7 @@ FORCEINLINE bool AwareLock::TryEnterHelper(Thread* pCurThread)
     if (m_lockState.InterlockedTryLock())
     {
         m_HoldingThread = pCurThread;
+        m_HoldingOSThreadId = pCurThread->GetOSThreadId();
         m_Recursion = 1;
         pCurThread->IncLockCount();
         return true;
@@ -525,6 +551,7 @@ FORCEINLINE AwareLock::EnterHelperResult AwareLock::TryEnterBeforeSpinLoopHelper
 
         // Lock was acquired and the spinner was not registered
         m_HoldingThread = pCurThread;
+        m_HoldingOSThreadId = pCurThread->GetOSThreadId();
         m_Recursion = 1;
         pCurThread->IncLockCount();
         return EnterHelperResult_Entered;
@@ -557,6 +584,7 @@ FORCEINLINE AwareLock::EnterHelperResult AwareLock::TryEnterInsideSpinLoopHelper
 
     // Lock was acquired and spinner was unregistered
     m_HoldingThread = pCurThread;
+    m_HoldingOSThreadId = pCurThread->GetOSThreadId();
     m_Recursion = 1;
     pCurThread->IncLockCount();
     return EnterHelperResult_Entered;
@@ -580,6 +608,7 @@ FORCEINLINE bool AwareLock::TryEnterAfterSpinLoopHelper(Thread *pCurThread)
 
     // Spinner was unregistered and the lock was acquired
     m_HoldingThread = pCurThread;
+    m_HoldingOSThreadId = pCurThread->GetOSThreadId();
     m_Recursion = 1;
     pCurThread->IncLockCount();
     return true;
@@ -693,6 +722,7 @@ FORCEINLINE AwareLock::LeaveHelperAction AwareLock::LeaveHelper(Thread* pCurThre
     {
         m_HoldingThread->DecLockCount();
         m_HoldingThread = NULL;
+        m_HoldingOSThreadId = 0;
 
         // Clear lock bit and determine whether we must signal a waiter to wake
         if (!m_lockState.InterlockedUnlock())
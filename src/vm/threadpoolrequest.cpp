@@ -365,6 +365,11 @@ void UnManagedPerAppDomainTPCount::QueueUnmanagedWorkRequest(LPTHREAD_START_ROUT
 
     m_lock.Init(LOCK_TYPE_DEFAULT);
     
+    // PERF: This single queue is only used for native work items (timer
+    // completions, wait callbacks and the like). Managed work items go through
+    // the managed ThreadPoolWorkQueue, which already has per-thread local
+    // queues with stealing, and they only reach the native side as a
+    // request count.
     {
         SpinLock::Holder slh(&m_lock);
 
@@ -463,6 +468,9 @@ void UnManagedPerAppDomainTPCount::DispatchWorkItem(bool* foundWork, bool* wasNo
         wrFunction = pWorkRequest->Function;
         wrContext  = pWorkRequest->Context;
 
+        // Enqueue and dequeue events carry the work request's address as its ID, so a consumer can
+        // compute queueing latency from the pair without any bookkeeping here. Managed work items fire
+        // the same pair from the managed thread pool queue.
         if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_Context, ThreadPoolDequeue) &&
             !ThreadpoolMgr::AreEtwQueueEventsSpeciallyHandled(wrFunction))
             FireEtwThreadPoolDequeue(pWorkRequest, GetClrInstanceId());
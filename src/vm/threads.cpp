@@ -832,6 +832,10 @@ Thread* SetupUnstartedThread(BOOL bRequiresTSL)
     }
     CONTRACTL_END;
 
+    // Thread objects are not recycled. A dead thread's Thread stays in the ThreadStore until its
+    // external count drops to zero (normally when the exposed System.Threading.Thread object is
+    // finalized), and ~Thread removes it. Until then its handles, thread id and debugger/profiler
+    // identity still belong to the old managed thread, so it cannot be handed to a new one.
     Thread* pThread = new Thread();
 
     FastInterlockOr((ULONG *) &pThread->m_State,
@@ -1316,6 +1320,10 @@ Thread::Thread()
 
     m_alloc_context.init();
     m_thAllocContextObj = 0;
+#ifdef FEATURE_EVENT_TRACE
+    m_allocSampleNextBytes = 0;
+    m_allocSampleRandom = 0;
+#endif // FEATURE_EVENT_TRACE
 
     m_UserInterrupt = 0;
     m_WaitEventLink.m_Next = NULL;
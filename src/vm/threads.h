@@ -1636,6 +1636,12 @@ public:
 
     // on MP systems, each thread has its own allocation chunk so we can avoid
     // lock prefixes and expensive MP cache snooping stuff
+    //
+    // The context is owned by the thread because the JIT helpers bump alloc_ptr
+    // without any synchronization. Only the GC touches other threads' contexts,
+    // with the EE suspended, and every GC retires all of them. An idle thread
+    // therefore holds at most one quantum until the next GC. Per-CPU contexts
+    // would need restartable sequences in every allocation helper.
     gc_alloc_context        m_alloc_context;
 
     inline gc_alloc_context *GetAllocContext() { LIMITED_METHOD_CONTRACT; return &m_alloc_context; }
@@ -1644,6 +1650,14 @@ public:
     // we fire the AllocationTick event. It's only for tooling purpose.
     TypeHandle m_thAllocContextObj;
 
+#ifdef FEATURE_EVENT_TRACE
+    // Allocation sampling state (see code:ETW::TypeSystemLog::SampleObjectAllocation).
+    // The next sample point is expressed in bytes allocated by this thread; the random
+    // state is a per-thread xorshift seed so threads don't need to synchronize.
+    UINT64 m_allocSampleNextBytes;
+    UINT32 m_allocSampleRandom;
+#endif // FEATURE_EVENT_TRACE
+
 #ifndef FEATURE_PAL    
 private:
     _NT_TIB *m_pTEB;
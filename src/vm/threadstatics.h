@@ -533,6 +533,14 @@ class ThreadStatics
     }
 
 #ifndef DACCESS_COMPILE
+    // PERF: This is the whole cost of the thread static fast path in the
+    // JIT_GetShared*ThreadStaticBase helpers: GetThread() (itself a TLS read),
+    // then an index into the ThreadLocalBlock's TLM table and the class init
+    // bit check. Letting the JIT inline this as raw FS/GS or TPIDR_EL0
+    // relative loads would need the VM to hand out a fixed TLS offset for
+    // the Thread pointer through the JIT-EE interface, which is only stable
+    // for initial-exec TLS in the main image, and would still need the TLM
+    // lookup since thread statics are allocated lazily per module.
     FORCEINLINE static ThreadLocalBlock* GetCurrentTLB()
     {
         // Get the current thread
@@ -59,6 +59,15 @@ extern "C" void             RedirectedHandledJITCaseForGCStress_Stub(void);
 // our chances of snagging it at a safe spot).
 #define PING_JIT_TIMEOUT        10
 
+#if defined(FEATURE_HIJACK) && defined(PLATFORM_UNIX)
+// On Unix, a thread that was at a spot where the activation signal could not
+// suspend it is only signaled again when the rendezvous wait times out. Most
+// such threads reach an interruptible spot almost immediately, so the first
+// few waits use a much shorter timeout before falling back to PING_JIT_TIMEOUT.
+#define PING_JIT_SHORT_TIMEOUT          1
+#define PING_JIT_SHORT_TIMEOUT_COUNT    5
+#endif
+
 // When we find a thread in a spot that's not safe to abort -- how long to wait before
 // we try again.
 #define ABORT_POLL_TIMEOUT      10
@@ -4091,6 +4100,9 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
     // Now we keep retrying until we find that no threads are in cooperative mode.  This should be merged into 
     // the first loop.
     //
+#if defined(FEATURE_HIJACK) && defined(PLATFORM_UNIX)
+    DWORD shortTimeoutWaits = 0;
+#endif
     while (countThreads)
     {
         _ASSERTE (thread == NULL);
@@ -4184,7 +4196,15 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         // For now, we simply wait.
         //
 
-        res = g_pGCSuspendEvent->Wait(PING_JIT_TIMEOUT, FALSE);
+        DWORD waitTimeout = PING_JIT_TIMEOUT;
+#if defined(FEATURE_HIJACK) && defined(PLATFORM_UNIX)
+        if (shortTimeoutWaits < PING_JIT_SHORT_TIMEOUT_COUNT)
+        {
+            shortTimeoutWaits++;
+            waitTimeout = PING_JIT_SHORT_TIMEOUT;
+        }
+#endif
+        res = g_pGCSuspendEvent->Wait(waitTimeout, FALSE);
 
 
 #ifdef TIME_SUSPEND
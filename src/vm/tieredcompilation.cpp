@@ -38,9 +38,10 @@
 //
 // Methods initially call into OnMethodCalled() and once the call count exceeds
 // a fixed limit we queue work on to our internal list of methods needing to
-// be recompiled (m_methodsToOptimize). If there is currently no thread
-// servicing our queue asynchronously then we use the runtime threadpool
-// QueueUserWorkItem to recruit one. During the callback for each threadpool work
+// be recompiled (m_methodsToOptimize). If fewer threads than
+// TC_BackgroundWorkerCount are servicing our queue asynchronously and there
+// are more queued methods than servicing threads, then we use the runtime threadpool
+// QueueUserWorkItem to recruit one more. During the callback for each threadpool work
 // item we handle as many methods as possible in a fixed period of time, then
 // queue another threadpool work item if m_methodsToOptimize hasn't been drained.
 //
@@ -266,7 +267,7 @@ void TieredCompilationManager::AsyncPromoteMethodToTier1(MethodDesc* pMethodDesc
     // the queue if needed.
     //
     // Note an error here could affect concurrent threads running this
-    // code. Those threads will observe m_countOptimizationThreadsRunning > 0 and return,
+    // code. Those threads may observe m_countOptimizationThreadsRunning at its limit and return,
     // then QueueUserWorkItem fails on this thread lowering the count and leaves them 
     // unserviced. Synchronous retries appear unlikely to offer any material improvement 
     // and complicating the code to narrow an already rare error case isn't desirable.
@@ -614,6 +615,10 @@ void TieredCompilationManager::OptimizeMethodsCallback()
 // on a background thread. Each such method will be jitted with code
 // optimizations enabled and then installed as the active implementation
 // of the method entrypoint.
+//
+// Tier1 code is always produced in process. JIT'd code embeds absolute addresses of
+// this process's MethodTables, statics and stubs rather than indirection cells, so it
+// cannot be persisted and reused by another process the way R2R code can.
 void TieredCompilationManager::OptimizeMethods()
 {
     WRAPPER_NO_CONTRACT;
@@ -807,13 +812,14 @@ bool TieredCompilationManager::IncrementWorkerThreadCountIfNeeded()
     WRAPPER_NO_CONTRACT;
     // m_lock should be held
 
-    if (0 == m_countOptimizationThreadsRunning &&
+    // Only recruit another thread when there is at least one queued method that the running
+    // threads have not already been counted against, so that a burst of promotions does not
+    // start more threads than there is work for
+    if (m_countOptimizationThreadsRunning < g_pConfig->TieredCompilation_BackgroundWorkerCount() &&
+        m_countOfMethodsToOptimize > m_countOptimizationThreadsRunning &&
         !m_isAppDomainShuttingDown &&
-        !m_methodsToOptimize.IsEmpty() &&
         !IsTieringDelayActive())
     {
-        // Our current policy throttles at 1 thread, but in the future we
-        // could experiment with more parallelism.
         m_countOptimizationThreadsRunning++;
         return true;
     }
@@ -839,6 +845,63 @@ DWORD TieredCompilationManager::DebugGetWorkerThreadCount()
 }
 #endif
 
+// Called by the JIT interface when instrumented tier-0 code is being generated for a
+// method. Returns zeroed storage for the method's block counts; any counts left over
+// from an earlier tier-0 compilation of the same method are replaced.
+ICorJitInfo::BlockCounts* TieredCompilationManager::AllocateMethodBlockCounts(MethodDesc* pMethodDesc, UINT32 count, UINT32 ilSize)
+{
+    STANDARD_VM_CONTRACT;
+    _ASSERTE(g_pConfig->TieredPGO());
+    _ASSERTE(pMethodDesc->IsEligibleForTieredCompilation());
+    _ASSERTE(!pMethodDesc->GetLoaderAllocator()->IsCollectible());
+
+    // Memory allocated on the LowFrequencyHeap is zero filled
+    LoaderHeap* pHeap = pMethodDesc->GetLoaderAllocator()->GetLowFrequencyHeap();
+    S_SIZE_T countsSize = S_SIZE_T(count) * S_SIZE_T(sizeof(ICorJitInfo::BlockCounts));
+    ICorJitInfo::BlockCounts* pBlockCounts = (ICorJitInfo::BlockCounts*)(void*)pHeap->AllocMem(countsSize);
+    MethodBlockCounts* pEntry = (MethodBlockCounts*)(void*)pHeap->AllocMem(S_SIZE_T(sizeof(MethodBlockCounts)));
+
+    pEntry->m_pMethodDesc = pMethodDesc;
+    pEntry->m_count = count;
+    pEntry->m_ilSize = ilSize;
+    pEntry->m_pBlockCounts = pBlockCounts;
+
+    {
+        CrstHolder holder(&m_lock);
+        m_methodBlockCounts.AddOrReplace(pEntry);
+    }
+
+    return pBlockCounts;
+}
+
+// Called by the JIT interface when a method is recompiled at tier 1. Returns false if
+// the method's tier-0 code was not instrumented.
+bool TieredCompilationManager::GetMethodBlockCounts(MethodDesc* pMethodDesc, UINT32* pCount, ICorJitInfo::BlockCounts** ppBlockCounts, UINT32* pILSize)
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(pCount != nullptr);
+    _ASSERTE(ppBlockCounts != nullptr);
+    _ASSERTE(pILSize != nullptr);
+
+    MethodBlockCounts* pEntry;
+    {
+        CrstHolder holder(&m_lock);
+        pEntry = m_methodBlockCounts.Lookup(pMethodDesc);
+    }
+
+    if (pEntry == nullptr)
+    {
+        return false;
+    }
+
+    // The tier-0 code may still be running and updating the counts; the JIT only
+    // needs a reasonably recent snapshot.
+    *pCount = pEntry->m_count;
+    *ppBlockCounts = pEntry->m_pBlockCounts;
+    *pILSize = pEntry->m_ilSize;
+    return true;
+}
+
 //static
 CORJIT_FLAGS TieredCompilationManager::GetJitFlags(NativeCodeVersion nativeCodeVersion)
 {
@@ -857,10 +920,23 @@ CORJIT_FLAGS TieredCompilationManager::GetJitFlags(NativeCodeVersion nativeCodeV
     {
         case NativeCodeVersion::OptimizationTier0:
             flags.Set(CORJIT_FLAGS::CORJIT_FLAG_TIER0);
+            // Record block counts for the tier 1 compilation. The counts of a collectible
+            // method would be freed with its loader allocator while still in the
+            // AppDomain-wide m_methodBlockCounts, so those methods are not instrumented.
+            if (g_pConfig->TieredPGO() &&
+                !nativeCodeVersion.GetMethodDesc()->GetLoaderAllocator()->IsCollectible())
+            {
+                flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
+            }
             break;
 
         case NativeCodeVersion::OptimizationTier1:
             flags.Set(CORJIT_FLAGS::CORJIT_FLAG_TIER1);
+            if (g_pConfig->TieredPGO())
+            {
+                // Use the block counts recorded by tier 0, if any
+                flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBOPT);
+            }
             // fall through
 
         case NativeCodeVersion::OptimizationTierOptimized:
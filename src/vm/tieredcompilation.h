@@ -10,6 +10,48 @@
 #ifndef TIERED_COMPILATION_H
 #define TIERED_COMPILATION_H
 
+#ifdef FEATURE_TIERED_COMPILATION
+
+// Block counts recorded by the instrumented tier-0 code of a method when TieredPGO
+// is enabled, handed back to the JIT when the method is recompiled at tier 1.
+// Allocated on the method's loader allocator, so it lives as long as the code; the
+// table holding these is never pruned so collectible methods are not instrumented.
+struct MethodBlockCounts
+{
+    MethodDesc* m_pMethodDesc;
+    UINT32 m_count;
+    UINT32 m_ilSize;
+    ICorJitInfo::BlockCounts* m_pBlockCounts;
+};
+
+class MethodBlockCountsHashTraits : public NoRemoveSHashTraits<DefaultSHashTraits<MethodBlockCounts*>>
+{
+public:
+    typedef MethodDesc* key_t;
+
+    static key_t GetKey(element_t e)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return e->m_pMethodDesc;
+    }
+
+    static BOOL Equals(key_t k1, key_t k2)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return k1 == k2;
+    }
+
+    static count_t Hash(key_t k)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (count_t)(size_t)k;
+    }
+};
+
+typedef SHash<MethodBlockCountsHashTraits> MethodBlockCountsHash;
+
+#endif // FEATURE_TIERED_COMPILATION
+
 // TieredCompilationManager determines which methods should be recompiled and
 // how they should be recompiled to best optimize the running code. It then
 // handles logistics of getting new code created and installed.
@@ -40,6 +82,9 @@ public:
     void Shutdown();
     static CORJIT_FLAGS GetJitFlags(NativeCodeVersion nativeCodeVersion);
 
+    ICorJitInfo::BlockCounts* AllocateMethodBlockCounts(MethodDesc* pMethodDesc, UINT32 count, UINT32 ilSize);
+    bool GetMethodBlockCounts(MethodDesc* pMethodDesc, UINT32* pCount, ICorJitInfo::BlockCounts** ppBlockCounts, UINT32* pILSize);
+
 private:
     bool IsTieringDelayActive();
     bool TryInitiateTieringDelay();
@@ -71,6 +116,7 @@ private:
     SArray<MethodDesc*>* m_methodsPendingCountingForTier1;
     HANDLE m_tieringDelayTimerHandle;
     bool m_tier1CallCountingCandidateMethodRecentlyRecorded;
+    MethodBlockCountsHash m_methodBlockCounts;
 
     CLREvent m_asyncWorkDoneEvent;
 
@@ -25,6 +25,11 @@
 // - for an instantiated type, the typedef module, typedef token, and instantiation
 // - for an array/pointer type, the CorElementType, rank, and type parameter
 //
+// Lookups take no lock. NgenHashTable publishes inserts and bucket array growth with
+// memory barriers, so a concurrent reader either finds a fully initialized entry or
+// misses. A miss may be caused by a concurrent resize, so ClassLoader::LookupTypeHandleForTypeKey
+// retries a missed lookup under m_AvailableTypesLock before treating the type as not loaded.
+//
 //========================================================================================
 
 // One of these is present for each element in the table
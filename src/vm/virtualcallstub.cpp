@@ -3828,9 +3828,9 @@ void DispatchCache::LogStats()
 }
 
 /* The following tablse have bits that have the following properties:
-   1. Each entry has 12-bits with 5,6 or 7 one bits and 5,6 or 7 zero bits.
+   1. Each entry has 13-bits with 5 to 8 one bits and 5 to 8 zero bits.
    2. For every bit we try to have half one bits and half zero bits
-   3. Adjacent entries when xor-ed should have 5,6 or 7 bits that are different
+   3. Adjacent entries when xor-ed should have 5 to 8 bits that are different
 */
 #ifdef _WIN64 
 static const UINT16 tokenHashBits[64] =
@@ -3838,24 +3838,24 @@ static const UINT16 tokenHashBits[64] =
 static const UINT16 tokenHashBits[32] =
 #endif // !_WIN64
 {
-    0xcd5, 0x8b9, 0x875, 0x439,
-    0xbf0, 0x38d, 0xa5b, 0x6a7,
-    0x78a, 0x9c8, 0xee2, 0x3d3,
-    0xd94, 0x54e, 0x698, 0xa6a,
-    0x753, 0x932, 0x4b7, 0x155,
-    0x3a7, 0x9c8, 0x4e9, 0xe0b,
-    0xf05, 0x994, 0x472, 0x626,
-    0x15c, 0x3a8, 0x56e, 0xe2d,
+    0x0cd5, 0x18b9, 0x0875, 0x1439,
+    0x0bf0, 0x138d, 0x0a5b, 0x16a7,
+    0x078a, 0x19c8, 0x0ee2, 0x13d3,
+    0x0d94, 0x154e, 0x0698, 0x1a6a,
+    0x0753, 0x1932, 0x04b7, 0x1155,
+    0x03a7, 0x19c8, 0x04e9, 0x1e0b,
+    0x0f05, 0x1994, 0x0472, 0x1626,
+    0x015c, 0x13a8, 0x056e, 0x1e2d,
 
 #ifdef _WIN64 
-    0xe3c, 0xbe2, 0x58e, 0x0f3,
-    0x54d, 0x70f, 0xf88, 0xe2b,
-    0x353, 0x153, 0x4a5, 0x943,
-    0xaf2, 0x88f, 0x72e, 0x978,
-    0xa13, 0xa0b, 0xc3c, 0xb72,
-    0x0f7, 0x49a, 0xdd0, 0x366,
-    0xd84, 0xba5, 0x4c5, 0x6bc,
-    0x8ec, 0x0b9, 0x617, 0x85c,
+    0x0e3c, 0x1be2, 0x058e, 0x10f3,
+    0x054d, 0x170f, 0x0f88, 0x1e2b,
+    0x0353, 0x1153, 0x04a5, 0x1943,
+    0x0af2, 0x188f, 0x072e, 0x1978,
+    0x0a13, 0x1a0b, 0x0c3c, 0x1b72,
+    0x00f7, 0x149a, 0x0dd0, 0x1366,
+    0x0d84, 0x1ba5, 0x04c5, 0x16bc,
+    0x08ec, 0x10b9, 0x0617, 0x185c,
 #endif // _WIN64
 };
 
@@ -3869,7 +3869,7 @@ static const UINT16 tokenHashBits[32] =
     // Note if you change the number of bits in CALL_STUB_CACHE_NUM_BITS
     // then we have to recompute the hash function
     // Though making the number of bits smaller should still be OK
-    static_assert_no_msg(CALL_STUB_CACHE_NUM_BITS <= 12);
+    static_assert_no_msg(CALL_STUB_CACHE_NUM_BITS <= 13);
 
     while (token)
     {
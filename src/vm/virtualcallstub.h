@@ -212,6 +212,12 @@ typedef VPTR(class VirtualCallStubManager) PTR_VirtualCallStubManager;
 //         resolve stub (thus avoiding the overhead of the quick check that always seems to be failing and
 //         the miss count update).
 //         
+// There is no intermediate polymorphic stage: a call site that sees a handful of types goes straight from a
+// dispatch stub to its resolve stub. A per-site stub caching several (MethodTable, target) pairs inline would
+// need a new stub kind with code generators for every architecture (see the StubHolder types in the
+// <arch>/virtualcallstubcpu.hpp files), a range list and stub manager support for it, and a way to regenerate
+// or chain it as more types are seen, since stubs are immutable once published.
+//
 // QUESTION: What is the lifetimes of the various stubs and hash table entries?
 // 
 // QUESTION: There does not seem to be any logic that will change a call site's cell once it becomes a
@@ -1006,8 +1012,8 @@ extern UINT32 STUB_COLLIDE_MONO_PCT;
 
 //size and mask of the cache used by resolve stubs
 // CALL_STUB_CACHE_SIZE must be equal to 2^CALL_STUB_CACHE_NUM_BITS
-#define CALL_STUB_CACHE_NUM_BITS 12 //10
-#define CALL_STUB_CACHE_SIZE 4096 //1024
+#define CALL_STUB_CACHE_NUM_BITS 13 //12
+#define CALL_STUB_CACHE_SIZE 8192 //4096
 #define CALL_STUB_CACHE_MASK (CALL_STUB_CACHE_SIZE-1)
 #define CALL_STUB_CACHE_PROBES 5
 //min sizes for BucketTable and buckets and the growth and hashing constants
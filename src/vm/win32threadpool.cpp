@@ -106,14 +106,14 @@ LARGE_INTEGER ThreadpoolMgr::CurrentSampleStartTime;
 unsigned int ThreadpoolMgr::WorkerThreadSpinLimit;
 bool ThreadpoolMgr::IsHillClimbingDisabled;
 int ThreadpoolMgr::ThreadAdjustmentInterval;
+unsigned int ThreadpoolMgr::GateThreadDelay;
 
 #define INVALID_HANDLE ((HANDLE) -1)
 #define NEW_THREAD_THRESHOLD            7       // Number of requests outstanding before we start a new thread
 #define CP_THREAD_PENDINGIO_WAIT 5000           // polling interval when thread is retired but has a pending io
-#define GATE_THREAD_DELAY 500 /*milliseconds*/
 #define GATE_THREAD_DELAY_TOLERANCE 50 /*milliseconds*/
-#define DELAY_BETWEEN_SUSPENDS 5000 + GATE_THREAD_DELAY // time to delay between suspensions
-#define SUSPEND_TIME GATE_THREAD_DELAY+100      // milliseconds to suspend during SuspendProcessing
+#define DELAY_BETWEEN_SUSPENDS (5000 + GateThreadDelay) // time to delay between suspensions
+#define SUSPEND_TIME (GateThreadDelay + 100)    // milliseconds to suspend during SuspendProcessing
 
 LONG ThreadpoolMgr::Initialization=0;           // indicator of whether the threadpool is initialized.
 
@@ -362,6 +362,12 @@ BOOL ThreadpoolMgr::Initialize()
         WorkerThreadSpinLimit = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_UnfairSemaphoreSpinLimit);
         IsHillClimbingDisabled = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_Disable) != 0;
         ThreadAdjustmentInterval = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_HillClimbing_SampleIntervalLow);
+
+        // A shorter gate thread delay makes starvation injection react faster when workers are
+        // blocked (low CPU utilization with a stalled queue), at the cost of more gate thread wakeups.
+        GateThreadDelay = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_ThreadPool_GateThreadDelay);
+        if (GateThreadDelay < GATE_THREAD_DELAY_TOLERANCE)
+            GateThreadDelay = GATE_THREAD_DELAY_TOLERANCE;
         
         pADTPCount->InitResources();
         WorkerCriticalSection.Init(CrstThreadpoolWorker);
@@ -1130,6 +1136,11 @@ BOOL ThreadpoolMgr::PostQueuedCompletionStatus(LPOVERLAPPED lpOverlapped,
                                         (ULONG_PTR) Function,
                                         lpOverlapped);
 #else  
+    // There is no completion port on Unix. Socket and file I/O completions
+    // are dispatched by the managed socket engines (epoll/kqueue based) on
+    // ordinary worker threads, so there is nothing to post to here. Exposing
+    // a PAL epoll engine through this API would not help those callers:
+    // they would first have to move off their own event loops.
     SetLastError(ERROR_CALL_NOT_IMPLEMENTED);
     return FALSE;
 #endif // !FEATURE_PAL
@@ -4005,7 +4016,7 @@ int ThreadpoolMgr::GetCPUBusyTime_NT(PAL_IOCP_CPU_INFORMATION* pOldInfo)
 #endif // !FEATURE_PAL
 
 //
-// A timer that ticks every GATE_THREAD_DELAY milliseconds.  
+// A timer that ticks every ThreadpoolMgr::GateThreadDelay milliseconds.  
 // On platforms that support it, we use a coalescable waitable timer object.
 // For other platforms, we use Sleep, via __SwitchToThread.
 //
@@ -4031,12 +4042,12 @@ public:
             if (m_hTimer)
             {
                 //
-                // Set the timer to fire GATE_THREAD_DELAY milliseconds from now, then every GATE_THREAD_DELAY milliseconds thereafter.
+                // Set the timer to fire GateThreadDelay milliseconds from now, then every GateThreadDelay milliseconds thereafter.
                 // We also set the tolerance to GET_THREAD_DELAY_TOLERANCE, allowing the OS to coalesce this timer.
                 //
                 LARGE_INTEGER dueTime;
-                dueTime.QuadPart = MILLI_TO_100NANO(-(LONGLONG)GATE_THREAD_DELAY); //negative value indicates relative time
-                if (!g_pufnSetWaitableTimerEx(m_hTimer, &dueTime, GATE_THREAD_DELAY, NULL, NULL, NULL, GATE_THREAD_DELAY_TOLERANCE))
+                dueTime.QuadPart = MILLI_TO_100NANO(-(LONGLONG)ThreadpoolMgr::GateThreadDelay); //negative value indicates relative time
+                if (!g_pufnSetWaitableTimerEx(m_hTimer, &dueTime, ThreadpoolMgr::GateThreadDelay, NULL, NULL, NULL, GATE_THREAD_DELAY_TOLERANCE))
                 {
                     CloseHandle(m_hTimer);
                     m_hTimer = NULL;
@@ -4078,7 +4089,7 @@ public:
             WaitForSingleObject(m_hTimer, INFINITE);
         else
 #endif // !FEATURE_PAL
-            __SwitchToThread(GATE_THREAD_DELAY, CALLER_LIMITS_SPINNING);
+            __SwitchToThread(ThreadpoolMgr::GateThreadDelay, CALLER_LIMITS_SPINNING);
     }
 };
 
@@ -4266,7 +4277,7 @@ DWORD WINAPI ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
                         CompletionStatus = new (nothrow) QueuedStatus;
                         if (CompletionStatus == NULL)
                         {
-                            __SwitchToThread(GATE_THREAD_DELAY, CALLER_LIMITS_SPINNING);
+                            __SwitchToThread(GateThreadDelay, CALLER_LIMITS_SPINNING);
                         }
                     }
                     while (CompletionStatus == NULL);
@@ -4291,7 +4302,7 @@ DWORD WINAPI ThreadpoolMgr::GateThreadStart(LPVOID lpArgs)
                     // loop, retrying until thread is created.
                     while (!CreateCompletionPortThread((LPVOID)CompletionStatus))
                     {
-                        __SwitchToThread(GATE_THREAD_DELAY, CALLER_LIMITS_SPINNING);
+                        __SwitchToThread(GateThreadDelay, CALLER_LIMITS_SPINNING);
                     }
                 }
             }
@@ -4361,7 +4372,7 @@ BOOL ThreadpoolMgr::SufficientDelaySinceLastSample(unsigned int LastThreadCreati
 
     unsigned delaySinceLastThreadCreation = dwCurrentTickCount - LastThreadCreationTime;
 
-    unsigned minWaitBetweenThreadCreation =  GATE_THREAD_DELAY;
+    unsigned minWaitBetweenThreadCreation =  GateThreadDelay;
 
     if (throttleRate > 0.0)
     {
@@ -4369,7 +4380,7 @@ BOOL ThreadpoolMgr::SufficientDelaySinceLastSample(unsigned int LastThreadCreati
 
         unsigned adjustedThreadCount = NumThreads > NumberOfProcessors ? (NumThreads - NumberOfProcessors) : 0;
 
-        minWaitBetweenThreadCreation = (unsigned) (GATE_THREAD_DELAY * pow((1.0 + throttleRate),(double)adjustedThreadCount));
+        minWaitBetweenThreadCreation = (unsigned) (GateThreadDelay * pow((1.0 + throttleRate),(double)adjustedThreadCount));
     }
     // the amount of time to wait should grow up as the number of threads is increased
 
@@ -4385,14 +4396,14 @@ BOOL ThreadpoolMgr::SufficientDelaySinceLastDequeue()
 {
     LIMITED_METHOD_CONTRACT;
 
-    #define DEQUEUE_DELAY_THRESHOLD (GATE_THREAD_DELAY * 2)
+    #define DEQUEUE_DELAY_THRESHOLD (GateThreadDelay * 2)
 
     unsigned delay = GetTickCount() - VolatileLoad(&LastDequeueTime);
     unsigned tooLong;
 
     if(cpuUtilization < CpuUtilizationLow)
     {
-        tooLong = GATE_THREAD_DELAY;
+        tooLong = GateThreadDelay;
     }
     else       
     {
@@ -4689,6 +4700,11 @@ DWORD ThreadpoolMgr::FireTimers()
     DWORD nextFiringInterval = (DWORD) -1;
     TimerInfo* timerInfo = NULL;
     
+    // PERF: This is a linear scan, but the list stays short. Managed timers
+    // (System.Threading.Timer) are kept in the managed TimerQueue, and each
+    // domain has a single native timer here, set to the earliest managed due
+    // time. A timing wheel in this list would not change the cost of large
+    // numbers of pending managed timers.
     EX_TRY 
     {
         for (LIST_ENTRY* node = (LIST_ENTRY*) TimerQueue.Flink;
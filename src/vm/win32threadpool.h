@@ -26,6 +26,10 @@ Revision History:
 #include "nativeoverlapped.h"
 #include "hillclimbing.h"
 
+// Each wait thread services at most this many registered waits, because it blocks in a single
+// WaitForMultipleObjectsEx, which is limited to MAXIMUM_WAIT_OBJECTS on Windows and in the PAL.
+// Raising it on Unix would need the PAL's wait machinery to stop scanning every object on each
+// wait, i.e. a different wait primitive (such as eventfd + epoll) for PAL events.
 #define MAX_WAITHANDLES 64
 
 #define MAX_CACHED_EVENTS 40        // upper limit on number of wait events cached 
@@ -103,6 +107,7 @@ class ThreadpoolMgr
     friend class ManagedPerAppDomainTPCount;
     friend class PerAppDomainTPCountList;
     friend class HillClimbing;
+    friend class GateThreadTimer;
     friend struct _DacGlobals;
 
 public:
@@ -1025,6 +1030,7 @@ private:
     static unsigned int WorkerThreadSpinLimit;
     static bool IsHillClimbingDisabled;
     static int ThreadAdjustmentInterval;
+    static unsigned int GateThreadDelay;
 
     SPTR_DECL(WorkRequest,WorkRequestHead);             // Head of work request queue
     SPTR_DECL(WorkRequest,WorkRequestTail);             // Head of work request queue
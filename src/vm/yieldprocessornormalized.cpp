@@ -27,10 +27,11 @@ static void InitializeYieldProcessorNormalized()
     // Intel pre-Skylake processor: measured typically 14-17 cycles per yield
     // Intel post-Skylake processor: measured typically 125-150 cycles per yield
     const int MeasureDurationMs = 10;
+    const int MeasurementCount = 5;
     const int NsPerSecond = 1000 * 1000 * 1000;
 
     LARGE_INTEGER li;
-    if (!QueryPerformanceFrequency(&li) || (ULONGLONG)li.QuadPart < 1000 / MeasureDurationMs)
+    if (!QueryPerformanceFrequency(&li) || (ULONGLONG)li.QuadPart < 1000 * MeasurementCount / MeasureDurationMs)
     {
         // High precision clock not available or clock resolution is too low, resort to defaults
         s_isYieldProcessorNormalizedInitialized = true;
@@ -38,28 +39,39 @@ static void InitializeYieldProcessorNormalized()
     }
     ULONGLONG ticksPerSecond = li.QuadPart;
 
-    // Measure the nanosecond delay per yield
-    ULONGLONG measureDurationTicks = ticksPerSecond / (1000 / MeasureDurationMs);
-    unsigned int yieldCount = 0;
-    QueryPerformanceCounter(&li);
-    ULONGLONG startTicks = li.QuadPart;
-    ULONGLONG elapsedTicks;
-    do
+    // Measure the nanosecond delay per yield. The measurement is split into several shorter windows and the smallest result
+    // is used, so that a window in which the thread was preempted or interrupted does not inflate the estimate (which would
+    // make normalized yields, and therefore spin-waits everywhere, too short).
+    ULONGLONG measureDurationTicks = ticksPerSecond / (1000 * MeasurementCount / MeasureDurationMs);
+    double nsPerYield = 0;
+    for (int measurementIndex = 0; measurementIndex < MeasurementCount; ++measurementIndex)
     {
-        // On some systems, querying the high performance counter has relatively significant overhead. Do enough yields to mask
-        // the timing overhead. Assuming one yield has a delay of MinNsPerNormalizedYield, 1000 yields would have a delay in the
-        // low microsecond range.
-        for (int i = 0; i < 1000; ++i)
+        unsigned int yieldCount = 0;
+        QueryPerformanceCounter(&li);
+        ULONGLONG startTicks = li.QuadPart;
+        ULONGLONG elapsedTicks;
+        do
+        {
+            // On some systems, querying the high performance counter has relatively significant overhead. Do enough yields to
+            // mask the timing overhead. Assuming one yield has a delay of MinNsPerNormalizedYield, 1000 yields would have a
+            // delay in the low microsecond range.
+            for (int i = 0; i < 1000; ++i)
+            {
+                System_YieldProcessor();
+            }
+            yieldCount += 1000;
+
+            QueryPerformanceCounter(&li);
+            ULONGLONG nowTicks = li.QuadPart;
+            elapsedTicks = nowTicks - startTicks;
+        } while (elapsedTicks < measureDurationTicks);
+
+        double measuredNsPerYield = (double)elapsedTicks * NsPerSecond / ((double)yieldCount * ticksPerSecond);
+        if (measurementIndex == 0 || measuredNsPerYield < nsPerYield)
         {
-            System_YieldProcessor();
+            nsPerYield = measuredNsPerYield;
         }
-        yieldCount += 1000;
-
-        QueryPerformanceCounter(&li);
-        ULONGLONG nowTicks = li.QuadPart;
-        elapsedTicks = nowTicks - startTicks;
-    } while (elapsedTicks < measureDurationTicks);
-    double nsPerYield = (double)elapsedTicks * NsPerSecond / ((double)yieldCount * ticksPerSecond);
+    }
     if (nsPerYield < 1)
     {
         nsPerYield = 1;
@@ -84,6 +96,10 @@ static void InitializeYieldProcessorNormalized()
         optimalMaxNormalizedYieldsPerSpinIteration = 1;
     }
 
+    STRESS_LOG3(LF_SYNC, LL_INFO10, "YieldProcessorNormalized: %u ns per yield, %d yields per normalized yield, "
+        "%d max normalized yields per spin iteration\n",
+        (unsigned int)nsPerYield, yieldsPerNormalizedYield, optimalMaxNormalizedYieldsPerSpinIteration);
+
     g_yieldsPerNormalizedYield = yieldsPerNormalizedYield;
     g_optimalMaxNormalizedYieldsPerSpinIteration = optimalMaxNormalizedYieldsPerSpinIteration;
     s_isYieldProcessorNormalizedInitialized = true;
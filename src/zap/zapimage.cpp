@@ -1715,6 +1715,77 @@ void ZapImage::CompileHotRegion()
     EndRegion(CORINFO_REGION_HOT);
 }
 
+//  CompileMethodOrderFile
+//     Compiles the methods listed in a <module>.order file next to the input module, in the
+//     order they are listed. The file holds one hexadecimal MethodDef token per line, which
+//     can be produced from the MethodToken field of the method load events in a startup trace.
+//     Since the methods are compiled ahead of the rest of the untrained code they get placed
+//     together at the front of it, without requiring IBC data.
+//
+void ZapImage::CompileMethodOrderFile()
+{
+    static ConfigDWORD g_UseMethodOrderFile;
+    if (g_UseMethodOrderFile.val(CLRConfig::EXTERNAL_UseMethodOrderFile) != 1)
+        return;
+
+    SString path(m_pModuleFileName);
+
+    SString::Iterator dot = path.End();
+    if (!path.FindBack(dot, '.'))
+        return;
+
+    SString slName(SString::Literal, "order");
+    path.Replace(dot+1, path.End() - (dot+1), slName);
+
+    HandleHolder hFile = WszCreateFile(path.GetUnicode(),
+                                 GENERIC_READ,
+                                 FILE_SHARE_READ,
+                                 NULL,
+                                 OPEN_EXISTING,
+                                 FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                                 NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+        return;
+
+    DWORD dwFileLen = SafeGetFileSize(hFile, 0);
+    if (dwFileLen == INVALID_FILE_SIZE || dwFileLen == 0)
+        return;
+
+    NewArrayHolder<char> pContents = new char[dwFileLen + 1];
+    DWORD cbRead;
+    if (!ReadFile(hFile, pContents, dwFileLen, &cbRead, NULL) || cbRead != dwFileLen)
+    {
+        m_zapper->Warning(W("Found method order file %s, but could not read it\n"), path.GetUnicode());
+        return;
+    }
+    pContents[dwFileLen] = '\0';
+
+    m_zapper->Info(W("Found method order file %s.\n"), path.GetUnicode());
+
+    char * pCurrent = pContents;
+    while (*pCurrent != '\0')
+    {
+        char * pEnd;
+        mdToken token = (mdToken)strtoul(pCurrent, &pEnd, 16);
+        if (pEnd == pCurrent)
+        {
+            // Skip anything that is not a token, such as blank lines
+            pCurrent++;
+            continue;
+        }
+        pCurrent = pEnd;
+
+        if (TypeFromToken(token) != mdtMethodDef || !m_pMDImport->IsValidToken(token))
+        {
+            m_zapper->Info(W("Warning: Ignoring invalid method token %08x in method order file.\n"), token);
+            continue;
+        }
+
+        // Methods that were already compiled for IBC data keep their place in the hot region
+        TryCompileMethodDef(token, 0);
+    }
+}
+
 //  CompileColdRegion
 //     Performs the compilation and placement for all methods in the the "Cold" code region
 //     Methods placed in this region typically correspond to all of the methods that were
@@ -1726,6 +1797,8 @@ void ZapImage::CompileColdRegion()
     //
 
     BeginRegion(CORINFO_REGION_COLD);
+
+    CompileMethodOrderFile();
     
     IMDInternalImport * pMDImport = m_pMDImport;
     
@@ -1783,6 +1856,15 @@ void ZapImage::Compile()
     //
     // Compile all of the methods for our AOT native image
     //
+    // Methods are compiled one at a time. ZapInfo is per method, but everything it
+    // feeds is shared and unsynchronized: the node tables of this image, the
+    // compiled method map, m_MethodCompilationOrder (whose order determines the
+    // image layout), and the preloader and compilation domain on the EE side, which
+    // load types while methods compile. Compiling methods in parallel would need
+    // all of these made thread-safe, plus a sort on method token before layout to
+    // keep output deterministic. Until then, build systems get parallelism by
+    // running one crossgen process per input assembly.
+    //
 
     bool doNothingNgen = false;
 #ifdef _DEBUG
@@ -2041,7 +2123,11 @@ ZapImage::CompileStatus ZapImage::TryCompileInstantiatedMethod(CORINFO_METHOD_HA
 }
 
 //-----------------------------------------------------------------------------
-
+//
+// Every method is compiled from scratch on each run. Reusing code from a previous image would be
+// unsafe without fingerprinting more than the method's own IL: the generated code also depends on
+// inlinees, field layouts and type loads in other modules, all of which are encoded in its fixups.
+//
 ZapImage::CompileStatus ZapImage::TryCompileMethodWorker(CORINFO_METHOD_HANDLE handle, mdMethodDef md, 
                                                          unsigned methodProfilingDataFlags)
 {
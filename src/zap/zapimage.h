@@ -862,6 +862,7 @@ public:
 
     void              ProfileDisableInlining();
     void              CompileHotRegion();
+    void              CompileMethodOrderFile();
     void              CompileColdRegion();
     void              PlaceMethodIL();
 };
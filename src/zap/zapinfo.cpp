@@ -3878,6 +3878,11 @@ BOOL ZapInfo::pInvokeMarshalingRequired(CORINFO_METHOD_HANDLE method,
         return TRUE;
     }
 
+    // Blittable, non-vararg P/Invokes in the version bubble come back FALSE
+    // here and are inlined into the precompiled caller, so they never need an
+    // IL stub at runtime. Anything that does need marshaling still has its IL
+    // stub generated and jitted on first call. Precompiling those stubs would
+    // need ILStubCache entries that can be keyed and fixed up from an R2R image.
     return m_pEEJitInfo->pInvokeMarshalingRequired(method, sig);
 }
 
@@ -47,6 +47,11 @@ void ZapReadyToRunHeader::Save(ZapWriter * pZapWriter)
     if (pImage->GetZapperOptions()->m_fPartialNGen)
         readyToRunHeader.Flags |= READYTORUN_FLAG_PARTIAL;
 
+    // Each image still describes a single assembly. With the large version bubble enabled, code may inline across
+    // the assemblies in the bubble, and the manifest metadata (see OutputManifestMetadataForReadyToRun) lists them.
+    // Nothing records the exact versions of those assemblies, so the runtime cannot check at load time that the
+    // bubble it was compiled against is still intact; keeping the bubble consistent is left to the deployment.
+
     readyToRunHeader.NumberOfSections = m_Sections.GetCount();
 
     pZapWriter->Write(&readyToRunHeader, sizeof(readyToRunHeader));
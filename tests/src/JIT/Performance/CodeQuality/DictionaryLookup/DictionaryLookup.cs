@@ -0,0 +1,67 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Generic collection lookups and growth: shared generic code, devirtualization of
+// EqualityComparer<T>.Default and List<T> indexer inlining.
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+
+namespace CodeQuality
+{
+    class DictionaryLookup
+    {
+        const int Count = 4096;
+        const int DefaultIterations = 500;
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static long Run(Dictionary<int, int> dict, List<int> keys)
+        {
+            long sum = 0;
+            for (int i = 0; i < keys.Count; i++)
+            {
+                int value;
+                if (dict.TryGetValue(keys[i], out value))
+                {
+                    sum += value;
+                }
+            }
+            return sum;
+        }
+
+        static int Main(string[] args)
+        {
+            int iterations = (args.Length > 0) ? int.Parse(args[0]) : DefaultIterations;
+
+            Dictionary<int, int> dict = new Dictionary<int, int>();
+            List<int> keys = new List<int>();
+            for (int i = 0; i < Count; i++)
+            {
+                dict[i * 7] = i;
+                // Half of the keys miss
+                keys.Add(i * 7 + (i & 1));
+            }
+
+            long expected = 0;
+            for (int i = 0; i < Count; i += 2)
+            {
+                expected += i;
+            }
+
+            long result = 0;
+            Stopwatch sw = Stopwatch.StartNew();
+            for (int i = 0; i < iterations; i++)
+            {
+                result = Run(dict, keys);
+            }
+            sw.Stop();
+
+            Console.WriteLine("DictionaryLookup: {0} iterations in {1} ms", iterations, sw.ElapsedMilliseconds);
+
+            return (iterations == 0 || result == expected) ? 100 : -1;
+        }
+    }
+}
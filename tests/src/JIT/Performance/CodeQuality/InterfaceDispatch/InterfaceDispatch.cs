@@ -0,0 +1,138 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Polymorphic call sites: virtual stub dispatch for interface calls, vtable calls
+// for virtual methods, and devirtualization of sealed types.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+
+namespace CodeQuality
+{
+    interface IShape
+    {
+        int Area();
+    }
+
+    abstract class Shape : IShape
+    {
+        public abstract int Area();
+    }
+
+    sealed class Square : Shape
+    {
+        int _side;
+        public Square(int side) { _side = side; }
+        public override int Area() { return _side * _side; }
+    }
+
+    sealed class Rectangle : Shape
+    {
+        int _width, _height;
+        public Rectangle(int width, int height) { _width = width; _height = height; }
+        public override int Area() { return _width * _height; }
+    }
+
+    sealed class Triangle : Shape
+    {
+        int _base, _height;
+        public Triangle(int b, int height) { _base = b; _height = height; }
+        public override int Area() { return _base * _height / 2; }
+    }
+
+    class InterfaceDispatch
+    {
+        const int Count = 1024;
+        const int DefaultIterations = 20000;
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static long SumInterface(IShape[] shapes)
+        {
+            long sum = 0;
+            for (int i = 0; i < shapes.Length; i++)
+            {
+                sum += shapes[i].Area();
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static long SumVirtual(Shape[] shapes)
+        {
+            long sum = 0;
+            for (int i = 0; i < shapes.Length; i++)
+            {
+                sum += shapes[i].Area();
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static long SumSealed(Square[] squares)
+        {
+            long sum = 0;
+            for (int i = 0; i < squares.Length; i++)
+            {
+                sum += squares[i].Area();
+            }
+            return sum;
+        }
+
+        static int Main(string[] args)
+        {
+            int iterations = (args.Length > 0) ? int.Parse(args[0]) : DefaultIterations;
+
+            Shape[] shapes = new Shape[Count];
+            IShape[] ishapes = new IShape[Count];
+            Square[] squares = new Square[Count];
+            long expectedShapes = 0;
+            long expectedSquares = 0;
+            for (int i = 0; i < Count; i++)
+            {
+                int n = i % 10;
+                switch (i % 3)
+                {
+                    case 0: shapes[i] = new Square(n); break;
+                    case 1: shapes[i] = new Rectangle(n, n + 1); break;
+                    default: shapes[i] = new Triangle(n, n + 2); break;
+                }
+                ishapes[i] = shapes[i];
+                squares[i] = new Square(n);
+                expectedShapes += shapes[i].Area();
+                expectedSquares += n * n;
+            }
+
+            long interfaceResult = 0, virtualResult = 0, sealedResult = 0;
+
+            Stopwatch sw = Stopwatch.StartNew();
+            for (int i = 0; i < iterations; i++)
+            {
+                interfaceResult = SumInterface(ishapes);
+            }
+            long interfaceMs = sw.ElapsedMilliseconds;
+
+            sw.Restart();
+            for (int i = 0; i < iterations; i++)
+            {
+                virtualResult = SumVirtual(shapes);
+            }
+            long virtualMs = sw.ElapsedMilliseconds;
+
+            sw.Restart();
+            for (int i = 0; i < iterations; i++)
+            {
+                sealedResult = SumSealed(squares);
+            }
+            long sealedMs = sw.ElapsedMilliseconds;
+
+            Console.WriteLine("InterfaceDispatch: {0} iterations, interface {1} ms, virtual {2} ms, sealed {3} ms",
+                iterations, interfaceMs, virtualMs, sealedMs);
+
+            bool passed = (iterations == 0) ||
+                ((interfaceResult == expectedShapes) && (virtualResult == expectedShapes) && (sealedResult == expectedSquares));
+            return passed ? 100 : -1;
+        }
+    }
+}
@@ -0,0 +1,97 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Dense matrix multiply over jagged arrays: bounds check elimination, loop
+// hoisting and floating point codegen in a nested loop kernel.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+
+namespace CodeQuality
+{
+    class MatMul
+    {
+        const int Size = 96;
+        const int DefaultIterations = 50;
+
+        static double[][] Create(int seed)
+        {
+            double[][] m = new double[Size][];
+            for (int i = 0; i < Size; i++)
+            {
+                m[i] = new double[Size];
+                for (int j = 0; j < Size; j++)
+                {
+                    m[i][j] = ((i * 31 + j * 17 + seed) % 13) - 6;
+                }
+            }
+            return m;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static void Multiply(double[][] a, double[][] b, double[][] c)
+        {
+            for (int i = 0; i < Size; i++)
+            {
+                double[] ci = c[i];
+                double[] ai = a[i];
+                for (int j = 0; j < Size; j++)
+                {
+                    ci[j] = 0;
+                }
+                for (int k = 0; k < Size; k++)
+                {
+                    double aik = ai[k];
+                    double[] bk = b[k];
+                    for (int j = 0; j < Size; j++)
+                    {
+                        ci[j] += aik * bk[j];
+                    }
+                }
+            }
+        }
+
+        static double Trace(double[][] m)
+        {
+            double sum = 0;
+            for (int i = 0; i < Size; i++)
+            {
+                sum += m[i][i];
+            }
+            return sum;
+        }
+
+        static int Main(string[] args)
+        {
+            int iterations = (args.Length > 0) ? int.Parse(args[0]) : DefaultIterations;
+
+            double[][] a = Create(1);
+            double[][] b = Create(2);
+            double[][] c = Create(0);
+
+            Stopwatch sw = Stopwatch.StartNew();
+            for (int i = 0; i < iterations; i++)
+            {
+                Multiply(a, b, c);
+            }
+            sw.Stop();
+
+            Console.WriteLine("MatMul: {0} iterations in {1} ms", iterations, sw.ElapsedMilliseconds);
+
+            // The inputs only hold small integers, so the result is exact and the trace can be checked
+            // against a naive triple loop.
+            double expected = 0;
+            for (int i = 0; i < Size; i++)
+            {
+                for (int k = 0; k < Size; k++)
+                {
+                    expected += a[i][k] * b[k][i];
+                }
+            }
+
+            return (iterations == 0 || Trace(c) == expected) ? 100 : -1;
+        }
+    }
+}
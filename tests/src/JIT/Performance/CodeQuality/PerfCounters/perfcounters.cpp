@@ -0,0 +1,136 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Runs a command under Linux hardware performance counters and prints the totals,
+// e.g. "perfcounters corerun MatMul.exe". Counters are enabled at exec and inherited
+// by all threads of the child, so they cover runtime startup, JIT and the benchmark.
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+struct Counter
+{
+    const char* name;
+    uint32_t type;
+    uint64_t config;
+    int fd;
+};
+
+static Counter s_counters[] =
+{
+    { "cycles",        PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES,          -1 },
+    { "instructions",  PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS,        -1 },
+    { "branches",      PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS, -1 },
+    { "branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES,       -1 },
+    { "cache-refs",    PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES,    -1 },
+    { "cache-misses",  PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES,        -1 },
+    { "page-faults",   PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS,         -1 },
+};
+
+static const size_t CounterCount = sizeof(s_counters) / sizeof(s_counters[0]);
+
+static int OpenCounter(Counter* counter, pid_t pid)
+{
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = counter->type;
+    attr.config = counter->config;
+    attr.disabled = 1;
+    attr.enable_on_exec = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    return (int)syscall(__NR_perf_event_open, &attr, pid, -1, -1, 0);
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: perfcounters <command> [arguments]\n");
+        return 1;
+    }
+
+    // The child blocks on the pipe until the counters are attached, so that none of its
+    // execution is missed.
+    int startPipe[2];
+    if (pipe(startPipe) != 0)
+    {
+        perror("pipe");
+        return 1;
+    }
+
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        perror("fork");
+        return 1;
+    }
+
+    if (pid == 0)
+    {
+        char go;
+        close(startPipe[1]);
+        if (read(startPipe[0], &go, 1) != 1)
+        {
+            _exit(127);
+        }
+        close(startPipe[0]);
+
+        execvp(argv[1], &argv[1]);
+        perror("execvp");
+        _exit(127);
+    }
+
+    close(startPipe[0]);
+
+    for (size_t i = 0; i < CounterCount; i++)
+    {
+        s_counters[i].fd = OpenCounter(&s_counters[i], pid);
+        if (s_counters[i].fd == -1)
+        {
+            fprintf(stderr, "perf_event_open(%s) failed: %s\n", s_counters[i].name, strerror(errno));
+        }
+    }
+
+    char go = 1;
+    if (write(startPipe[1], &go, 1) != 1)
+    {
+        perror("write");
+    }
+    close(startPipe[1]);
+
+    int status;
+    if (waitpid(pid, &status, 0) != pid)
+    {
+        perror("waitpid");
+        return 1;
+    }
+
+    for (size_t i = 0; i < CounterCount; i++)
+    {
+        uint64_t value;
+        if (s_counters[i].fd == -1)
+            continue;
+
+        if (read(s_counters[i].fd, &value, sizeof(value)) == sizeof(value))
+        {
+            fprintf(stderr, "%-14s %" PRIu64 "\n", s_counters[i].name, value);
+        }
+        close(s_counters[i].fd);
+    }
+
+    // Propagate the child's exit code so the test harness still sees the benchmark's result
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+}
@@ -0,0 +1,85 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Character scanning over strings: string indexer bounds checks, char comparisons
+// and the StringBuilder append paths.
+
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using System.Text;
+
+namespace CodeQuality
+{
+    class StringSearch
+    {
+        const int Lines = 2000;
+        const int DefaultIterations = 200;
+
+        static string BuildText()
+        {
+            StringBuilder sb = new StringBuilder();
+            for (int i = 0; i < Lines; i++)
+            {
+                sb.Append("key");
+                sb.Append(i);
+                sb.Append('=');
+                sb.Append("value number ");
+                sb.Append(i * 3);
+                sb.Append('\n');
+            }
+            return sb.ToString();
+        }
+
+        // Counts the digits that appear after '=' on each line
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int CountValueDigits(string text)
+        {
+            int count = 0;
+            bool inValue = false;
+            for (int i = 0; i < text.Length; i++)
+            {
+                char c = text[i];
+                if (c == '\n')
+                {
+                    inValue = false;
+                }
+                else if (c == '=')
+                {
+                    inValue = true;
+                }
+                else if (inValue && c >= '0' && c <= '9')
+                {
+                    count++;
+                }
+            }
+            return count;
+        }
+
+        static int Main(string[] args)
+        {
+            int iterations = (args.Length > 0) ? int.Parse(args[0]) : DefaultIterations;
+
+            string text = BuildText();
+
+            int expected = 0;
+            for (int i = 0; i < Lines; i++)
+            {
+                expected += (i * 3).ToString().Length;
+            }
+
+            int result = 0;
+            Stopwatch sw = Stopwatch.StartNew();
+            for (int i = 0; i < iterations; i++)
+            {
+                result = CountValueDigits(text);
+            }
+            sw.Stop();
+
+            Console.WriteLine("StringSearch: {0} iterations in {1} ms", iterations, sw.ElapsedMilliseconds);
+
+            return (iterations == 0 || result == expected) ? 100 : -1;
+        }
+    }
+}
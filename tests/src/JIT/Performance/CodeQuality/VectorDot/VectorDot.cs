@@ -0,0 +1,66 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Dot product with Vector<T>: SIMD intrinsic recognition, vector register allocation
+// and the scalar remainder loop.
+
+using System;
+using System.Diagnostics;
+using System.Numerics;
+using System.Runtime.CompilerServices;
+
+namespace CodeQuality
+{
+    class VectorDot
+    {
+        const int Length = 4099;
+        const int DefaultIterations = 20000;
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int Dot(int[] a, int[] b)
+        {
+            Vector<int> acc = Vector<int>.Zero;
+            int i = 0;
+            for (; i <= a.Length - Vector<int>.Count; i += Vector<int>.Count)
+            {
+                acc += new Vector<int>(a, i) * new Vector<int>(b, i);
+            }
+
+            int sum = Vector.Dot(acc, Vector<int>.One);
+            for (; i < a.Length; i++)
+            {
+                sum += a[i] * b[i];
+            }
+            return sum;
+        }
+
+        static int Main(string[] args)
+        {
+            int iterations = (args.Length > 0) ? int.Parse(args[0]) : DefaultIterations;
+
+            int[] a = new int[Length];
+            int[] b = new int[Length];
+            int expected = 0;
+            for (int i = 0; i < Length; i++)
+            {
+                a[i] = (i % 11) - 5;
+                b[i] = (i % 7) - 3;
+                expected += a[i] * b[i];
+            }
+
+            int result = 0;
+            Stopwatch sw = Stopwatch.StartNew();
+            for (int i = 0; i < iterations; i++)
+            {
+                result = Dot(a, b);
+            }
+            sw.Stop();
+
+            Console.WriteLine("VectorDot: {0} iterations in {1} ms (Vector<int>.Count = {2})",
+                iterations, sw.ElapsedMilliseconds, Vector<int>.Count);
+
+            return (iterations == 0 || result == expected) ? 100 : -1;
+        }
+    }
+}
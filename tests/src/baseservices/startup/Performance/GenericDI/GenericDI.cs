@@ -0,0 +1,113 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// The startup pattern of a web app: a dependency injection container registers
+// open generic services, and the first request resolves a graph of them closed
+// over many entity types. Most of the time goes to loading generic instantiations
+// and jitting or finding ReadyToRun code for their methods. Reports, besides the
+// harness' metrics:
+//   time_to_first_request_ms - from process creation to the first request handled
+//
+// Usage: GenericDI [runs]
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+using System.Reflection;
+
+interface IRepository<T> { List<T> GetAll(); }
+interface IValidator<T> { bool IsValid(T item); }
+interface IHandler<T> { int Handle(); }
+
+class Repository<T> : IRepository<T> where T : new()
+{
+    public List<T> GetAll() { return new List<T> { new T(), new T() }; }
+}
+
+class Validator<T> : IValidator<T>
+{
+    public bool IsValid(T item) { return item != null; }
+}
+
+class Handler<T> : IHandler<T>
+{
+    IRepository<T> _repository;
+    IValidator<T> _validator;
+
+    public Handler(IRepository<T> repository, IValidator<T> validator)
+    {
+        _repository = repository;
+        _validator = validator;
+    }
+
+    public int Handle() { return _repository.GetAll().Count(_validator.IsValid); }
+}
+
+class Entity0 { } class Entity1 { } class Entity2 { } class Entity3 { }
+class Entity4 { } class Entity5 { } class Entity6 { } class Entity7 { }
+class Entity8 { } class Entity9 { } class Entity10 { } class Entity11 { }
+class Entity12 { } class Entity13 { } class Entity14 { } class Entity15 { }
+class Entity16 { } class Entity17 { } class Entity18 { } class Entity19 { }
+class Entity20 { } class Entity21 { } class Entity22 { } class Entity23 { }
+class Entity24 { } class Entity25 { } class Entity26 { } class Entity27 { }
+class Entity28 { } class Entity29 { } class Entity30 { } class Entity31 { }
+
+// Just enough of a container: open generic registrations, constructor injection
+// and singletons.
+class ServiceProvider
+{
+    Dictionary<Type, Type> _registrations = new Dictionary<Type, Type>();
+    Dictionary<Type, object> _singletons = new Dictionary<Type, object>();
+
+    public void Register(Type service, Type implementation)
+    {
+        _registrations[service] = implementation;
+    }
+
+    public object Resolve(Type service)
+    {
+        object instance;
+        if (_singletons.TryGetValue(service, out instance))
+        {
+            return instance;
+        }
+
+        Type implementation = _registrations[service.GetGenericTypeDefinition()]
+            .MakeGenericType(service.GetGenericArguments());
+        ConstructorInfo constructor = implementation.GetConstructors()[0];
+        object[] arguments = constructor.GetParameters().Select(p => Resolve(p.ParameterType)).ToArray();
+
+        instance = constructor.Invoke(arguments);
+        _singletons[service] = instance;
+        return instance;
+    }
+}
+
+class GenericDI
+{
+    static int Main(string[] args)
+    {
+        return StartupHarness.Run(args, metrics =>
+        {
+            ServiceProvider provider = new ServiceProvider();
+            provider.Register(typeof(IRepository<>), typeof(Repository<>));
+            provider.Register(typeof(IValidator<>), typeof(Validator<>));
+            provider.Register(typeof(IHandler<>), typeof(Handler<>));
+
+            // The first request touches every entity type
+            int handled = 0;
+            Type[] entities = typeof(GenericDI).Assembly.GetTypes().Where(t => t.Name.StartsWith("Entity")).ToArray();
+            foreach (Type entity in entities)
+            {
+                object handler = provider.Resolve(typeof(IHandler<>).MakeGenericType(entity));
+                handled += (int)handler.GetType().GetMethod("Handle").Invoke(handler, null);
+            }
+
+            metrics["time_to_first_request_ms"] =
+                (DateTime.Now - Process.GetCurrentProcess().StartTime).TotalMilliseconds;
+            return (entities.Length == 32) && (handled == 2 * entities.Length);
+        });
+    }
+}
@@ -0,0 +1,22 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// The smallest startup: the runtime's own work before and after Main, with
+// nothing of the app's. See StartupHarness.cs for the metrics.
+//
+// Usage: HelloWorld [runs]
+
+using System;
+
+class HelloWorld
+{
+    static int Main(string[] args)
+    {
+        return StartupHarness.Run(args, metrics =>
+        {
+            Console.WriteLine("Hello World!");
+            return true;
+        });
+    }
+}
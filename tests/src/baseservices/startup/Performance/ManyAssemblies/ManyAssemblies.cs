@@ -0,0 +1,76 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Startup of an app that pulls in a lot of assemblies: it uses one type from each of
+// a set of framework assemblies, so the binder, the loader and the ReadyToRun image
+// setup run for each of them. Reports, besides the harness' metrics:
+//   assemblies_loaded - assemblies in the default context when the scenario is done
+//
+// Usage: ManyAssemblies [runs]
+
+using System;
+using System.Collections;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Collections.Immutable;
+using System.Collections.Specialized;
+using System.ComponentModel;
+using System.IO;
+using System.IO.Compression;
+using System.Linq;
+using System.Linq.Expressions;
+using System.Net;
+using System.Numerics;
+using System.Reflection.Metadata;
+using System.Runtime.CompilerServices;
+using System.Security.Cryptography;
+using System.Text;
+using System.Text.RegularExpressions;
+using System.Xml;
+using System.Xml.Linq;
+
+class ManyAssemblies
+{
+    // Kept out of Main so the assemblies load after the harness has taken its
+    // time_to_main_ms.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static bool UseAssemblies()
+    {
+        int checks = 0;
+
+        checks += new ConcurrentDictionary<int, int>().TryAdd(1, 1) ? 1 : 0;
+        checks += ImmutableArray.Create(1, 2).Length == 2 ? 1 : 0;
+        checks += new BitVector32(1)[1] ? 1 : 0;
+        checks += new Component().Site == null ? 1 : 0;
+        checks += Path.GetExtension("a.txt") == ".txt" ? 1 : 0;
+        checks += CompressionLevel.Optimal != CompressionLevel.NoCompression ? 1 : 0;
+        checks += Enumerable.Range(0, 10).Sum() == 45 ? 1 : 0;
+        checks += Expression.Lambda<Func<int>>(Expression.Constant(3)).Compile()() == 3 ? 1 : 0;
+        checks += IPAddress.Loopback.ToString() == "127.0.0.1" ? 1 : 0;
+        checks += BigInteger.Pow(2, 64).ToString() == "18446744073709551616" ? 1 : 0;
+        checks += new BlobBuilder().Count == 0 ? 1 : 0;
+        using (SHA256 sha = SHA256.Create())
+        {
+            checks += sha.ComputeHash(Encoding.UTF8.GetBytes("startup")).Length == 32 ? 1 : 0;
+        }
+        checks += Regex.IsMatch("startup", "^s.*p$") ? 1 : 0;
+        checks += new Hashtable { { 1, 1 } }.Count == 1 ? 1 : 0;
+        XmlDocument document = new XmlDocument();
+        document.LoadXml("<a><b/></a>");
+        checks += document.DocumentElement.ChildNodes.Count == 1 ? 1 : 0;
+        checks += XElement.Parse("<a><b/><b/></a>").Elements("b").Count() == 2 ? 1 : 0;
+
+        return checks == 16;
+    }
+
+    static int Main(string[] args)
+    {
+        return StartupHarness.Run(args, metrics =>
+        {
+            bool passed = UseAssemblies();
+            metrics["assemblies_loaded"] = AppDomain.CurrentDomain.GetAssemblies().Length;
+            return passed;
+        });
+    }
+}
@@ -0,0 +1,168 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Shared by the startup scenarios. Run without "-child", a scenario launches itself
+// as a child process a number of times, with ReadyToRun code and JIT-only, and prints
+// the median, minimum and maximum of each metric the child reports as CSV. With
+// "-child", it runs the scenario once and reports its metrics on stdout as
+// "name=value" lines:
+//   time_to_main_ms    - from process creation to the start of Main
+//   private_bytes      - private memory once the scenario is done
+//   minor/major_faults - page faults so far (Linux only)
+// plus whatever the scenario itself reports. The parent adds process_ms, the time
+// from starting the child to its exit.
+//
+// Usage: <scenario> [runs]
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.IO;
+using System.Linq;
+
+static class StartupHarness
+{
+    const string ChildArg = "-child";
+
+    static readonly string[][] Configurations = new string[][]
+    {
+        new string[] { "r2r" },
+        new string[] { "jitonly", "COMPlus_ReadyToRun", "0" },
+    };
+
+    // Call first thing in Main, so time_to_main_ms includes as little of the scenario
+    // as possible. The scenario adds its own metrics to the dictionary and returns
+    // false if it did not produce the right result.
+    public static int Run(string[] args, Func<Dictionary<string, double>, bool> scenario)
+    {
+        if ((args.Length > 0) && (args[0] == ChildArg))
+        {
+            return RunChild(scenario);
+        }
+
+        int runs = (args.Length > 0) ? int.Parse(args[0]) : 10;
+        return RunParent(runs) ? 100 : 1;
+    }
+
+    static int RunChild(Func<Dictionary<string, double>, bool> scenario)
+    {
+        Process process = Process.GetCurrentProcess();
+        double timeToMain = (DateTime.Now - process.StartTime).TotalMilliseconds;
+
+        Dictionary<string, double> metrics = new Dictionary<string, double>();
+        metrics["time_to_main_ms"] = timeToMain;
+
+        if (!scenario(metrics))
+        {
+            return 1;
+        }
+
+        process.Refresh();
+        metrics["private_bytes"] = process.PrivateMemorySize64;
+        AddPageFaults(metrics);
+
+        foreach (KeyValuePair<string, double> metric in metrics)
+        {
+            Console.WriteLine(string.Format(CultureInfo.InvariantCulture, "{0}={1:F2}", metric.Key, metric.Value));
+        }
+
+        return 100;
+    }
+
+    // Fields 10 and 12 of /proc/self/stat, after the parenthesized command name.
+    static void AddPageFaults(Dictionary<string, double> metrics)
+    {
+        const string statFile = "/proc/self/stat";
+        if (!File.Exists(statFile))
+        {
+            return;
+        }
+
+        string stat = File.ReadAllText(statFile);
+        string[] fields = stat.Substring(stat.LastIndexOf(')') + 2).Split(' ');
+        metrics["minor_faults"] = double.Parse(fields[7], CultureInfo.InvariantCulture);
+        metrics["major_faults"] = double.Parse(fields[9], CultureInfo.InvariantCulture);
+    }
+
+    static bool RunParent(int runs)
+    {
+        string host = Process.GetCurrentProcess().MainModule.FileName;
+        string assembly = typeof(StartupHarness).Assembly.Location;
+
+        Console.WriteLine("config,metric,median,min,max");
+        foreach (string[] configuration in Configurations)
+        {
+            Dictionary<string, List<double>> samples = new Dictionary<string, List<double>>();
+            for (int i = 0; i < runs; i++)
+            {
+                if (!RunChildProcess(host, assembly, configuration, samples))
+                {
+                    return false;
+                }
+            }
+
+            foreach (KeyValuePair<string, List<double>> metric in samples)
+            {
+                List<double> values = metric.Value;
+                values.Sort();
+                Console.WriteLine("{0},{1},{2:F2},{3:F2},{4:F2}", configuration[0], metric.Key,
+                    values[values.Count / 2], values[0], values[values.Count - 1]);
+            }
+        }
+
+        return true;
+    }
+
+    static bool RunChildProcess(string host, string assembly, string[] configuration,
+                                Dictionary<string, List<double>> samples)
+    {
+        ProcessStartInfo startInfo = new ProcessStartInfo(host, "\"" + assembly + "\" " + ChildArg);
+        startInfo.UseShellExecute = false;
+        startInfo.RedirectStandardOutput = true;
+        for (int i = 1; i < configuration.Length; i += 2)
+        {
+            startInfo.Environment[configuration[i]] = configuration[i + 1];
+        }
+
+        Stopwatch sw = Stopwatch.StartNew();
+        string output;
+        int exitCode;
+        using (Process child = Process.Start(startInfo))
+        {
+            output = child.StandardOutput.ReadToEnd();
+            child.WaitForExit();
+            exitCode = child.ExitCode;
+        }
+        sw.Stop();
+
+        if (exitCode != 100)
+        {
+            Console.WriteLine("{0} run failed with exit code {1}:", configuration[0], exitCode);
+            Console.WriteLine(output);
+            return false;
+        }
+
+        AddSample(samples, "process_ms", sw.Elapsed.TotalMilliseconds);
+        foreach (string line in output.Split('\n').Select(l => l.Trim()).Where(l => l.Contains("=")))
+        {
+            string[] metric = line.Split('=');
+            AddSample(samples, metric[0], double.Parse(metric[1], CultureInfo.InvariantCulture));
+        }
+
+        return true;
+    }
+
+    static void AddSample(Dictionary<string, List<double>> samples, string name, double value)
+    {
+        List<double> values;
+        if (!samples.TryGetValue(name, out values))
+        {
+            values = new List<double>();
+            samples[name] = values;
+        }
+
+        values.Add(value);
+    }
+}
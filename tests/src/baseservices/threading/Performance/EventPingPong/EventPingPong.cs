@@ -0,0 +1,76 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Round trips between pairs of threads handing control back and forth with two
+// AutoResetEvents. Measures the signal-to-wakeup latency of the PAL
+// synchronization manager, and how it holds up as the number of pairs grows.
+//
+// Usage: EventPingPong [maxPairs] [roundTrips]
+
+using System;
+using System.Diagnostics;
+using System.Threading;
+
+class EventPingPong
+{
+    static double Run(int pairs, int roundTrips)
+    {
+        Thread[] threads = new Thread[pairs * 2];
+        Barrier start = new Barrier(pairs * 2 + 1);
+        for (int i = 0; i < pairs; i++)
+        {
+            AutoResetEvent ping = new AutoResetEvent(false);
+            AutoResetEvent pong = new AutoResetEvent(false);
+
+            threads[i * 2] = new Thread(() =>
+            {
+                start.SignalAndWait();
+                for (int j = 0; j < roundTrips; j++)
+                {
+                    ping.Set();
+                    pong.WaitOne();
+                }
+            });
+            threads[i * 2 + 1] = new Thread(() =>
+            {
+                start.SignalAndWait();
+                for (int j = 0; j < roundTrips; j++)
+                {
+                    ping.WaitOne();
+                    pong.Set();
+                }
+            });
+        }
+
+        foreach (Thread t in threads)
+        {
+            t.Start();
+        }
+
+        start.SignalAndWait();
+        Stopwatch sw = Stopwatch.StartNew();
+        foreach (Thread t in threads)
+        {
+            t.Join();
+        }
+        sw.Stop();
+
+        // Microseconds per round trip, as seen by one pair
+        return sw.Elapsed.TotalMilliseconds * 1000.0 / roundTrips;
+    }
+
+    static int Main(string[] args)
+    {
+        int maxPairs = (args.Length > 0) ? int.Parse(args[0]) : Math.Max(Math.Min(Environment.ProcessorCount, 128) / 2, 1);
+        int roundTrips = (args.Length > 1) ? int.Parse(args[1]) : 20000;
+
+        Console.WriteLine("pairs,us/roundtrip");
+        for (int pairs = 1; pairs <= maxPairs; pairs *= 2)
+        {
+            Console.WriteLine("{0},{1:F2}", pairs, Run(pairs, roundTrips));
+        }
+
+        return 100;
+    }
+}
@@ -0,0 +1,86 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Monitor.Enter/Exit throughput on a single lock as the number of contending
+// threads grows. Covers the thin lock spin, the AwareLock inflation and the
+// wait/wake path once spinning gives up.
+//
+// Usage: MonitorContention [maxThreads] [durationMs]
+
+using System;
+using System.Diagnostics;
+using System.Threading;
+
+class MonitorContention
+{
+    static readonly object s_lock = new object();
+    static long s_counter;
+    static volatile bool s_stop;
+
+    static void Worker(object state)
+    {
+        long count = 0;
+        while (!s_stop)
+        {
+            lock (s_lock)
+            {
+                s_counter++;
+            }
+            count++;
+        }
+        // Each worker reports its own count through the single element array it was started with
+        ((long[])state)[0] = count;
+    }
+
+    static double Run(int threadCount, int durationMs)
+    {
+        s_counter = 0;
+        s_stop = false;
+
+        Thread[] threads = new Thread[threadCount];
+        long[][] results = new long[threadCount][];
+        for (int i = 0; i < threadCount; i++)
+        {
+            results[i] = new long[1];
+            threads[i] = new Thread(Worker);
+            threads[i].Start(results[i]);
+        }
+
+        Stopwatch sw = Stopwatch.StartNew();
+        Thread.Sleep(durationMs);
+        s_stop = true;
+        foreach (Thread t in threads)
+        {
+            t.Join();
+        }
+        sw.Stop();
+
+        long total = 0;
+        foreach (long[] r in results)
+        {
+            total += r[0];
+        }
+
+        if (total != s_counter)
+        {
+            throw new Exception("Lost updates under the lock: " + total + " != " + s_counter);
+        }
+
+        return total / sw.Elapsed.TotalSeconds;
+    }
+
+    static int Main(string[] args)
+    {
+        int maxThreads = (args.Length > 0) ? int.Parse(args[0]) : Math.Min(Environment.ProcessorCount, 128);
+        int durationMs = (args.Length > 1) ? int.Parse(args[1]) : 500;
+
+        Console.WriteLine("threads,acquisitions/s");
+        for (int threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            Console.WriteLine("{0},{1:F0}", threads, Run(threads, durationMs));
+        }
+
+        return 100;
+    }
+}
@@ -0,0 +1,61 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Blocks a growing number of thread pool workers and measures how long it takes
+// until a work item queued behind them runs. The time is dominated by the
+// starvation detection in the gate thread and by hill climbing's injection rate.
+//
+// Usage: StarvationRecovery [maxBlocked]
+
+using System;
+using System.Diagnostics;
+using System.Threading;
+
+class StarvationRecovery
+{
+    static double Run(int blockedCount)
+    {
+        ManualResetEvent release = new ManualResetEvent(false);
+        CountdownEvent blocked = new CountdownEvent(blockedCount);
+        ManualResetEvent probeRan = new ManualResetEvent(false);
+
+        for (int i = 0; i < blockedCount; i++)
+        {
+            ThreadPool.QueueUserWorkItem(_ =>
+            {
+                blocked.Signal();
+                release.WaitOne();
+            });
+        }
+
+        // Time from queueing the probe, once every blocking item is running, to the probe running
+        blocked.Wait();
+        Stopwatch sw = Stopwatch.StartNew();
+        ThreadPool.QueueUserWorkItem(_ => probeRan.Set());
+        probeRan.WaitOne();
+        sw.Stop();
+
+        release.Set();
+        return sw.Elapsed.TotalMilliseconds;
+    }
+
+    static int Main(string[] args)
+    {
+        int minWorkers, minIo;
+        ThreadPool.GetMinThreads(out minWorkers, out minIo);
+
+        int maxBlocked = (args.Length > 0) ? int.Parse(args[0]) : Math.Min(minWorkers * 4, 256);
+
+        Console.WriteLine("blocked,ms to run probe (min worker threads {0})", minWorkers);
+        for (int blocked = 1; blocked <= maxBlocked; blocked *= 2)
+        {
+            Console.WriteLine("{0},{1:F1}", blocked, Run(blocked));
+
+            // Let the pool retire the extra threads so each data point starts from the same state
+            Thread.Sleep(100);
+        }
+
+        return 100;
+    }
+}
@@ -0,0 +1,79 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Thread pool work item throughput as the number of producing threads grows.
+// Each producer queues short work items; the reported rate covers enqueue,
+// dispatch and completion, so it exercises the global and local work queues
+// and the worker wake-up path.
+//
+// Usage: ThreadPoolScaling [maxThreads] [itemsPerProducer]
+
+using System;
+using System.Diagnostics;
+using System.Threading;
+
+class ThreadPoolScaling
+{
+    static int s_pending;
+    static ManualResetEvent s_done = new ManualResetEvent(false);
+
+    static void WorkItem(object state)
+    {
+        if (Interlocked.Decrement(ref s_pending) == 0)
+        {
+            s_done.Set();
+        }
+    }
+
+    static double Run(int producers, int itemsPerProducer)
+    {
+        s_pending = producers * itemsPerProducer;
+        s_done.Reset();
+
+        WaitCallback callback = WorkItem;
+        Thread[] threads = new Thread[producers];
+        Barrier start = new Barrier(producers + 1);
+        for (int i = 0; i < producers; i++)
+        {
+            threads[i] = new Thread(() =>
+            {
+                start.SignalAndWait();
+                for (int j = 0; j < itemsPerProducer; j++)
+                {
+                    ThreadPool.QueueUserWorkItem(callback);
+                }
+            });
+            threads[i].Start();
+        }
+
+        start.SignalAndWait();
+        Stopwatch sw = Stopwatch.StartNew();
+        s_done.WaitOne();
+        sw.Stop();
+
+        foreach (Thread t in threads)
+        {
+            t.Join();
+        }
+
+        return producers * (double)itemsPerProducer / sw.Elapsed.TotalSeconds;
+    }
+
+    static int Main(string[] args)
+    {
+        int maxThreads = (args.Length > 0) ? int.Parse(args[0]) : Math.Min(Environment.ProcessorCount, 128);
+        int itemsPerProducer = (args.Length > 1) ? int.Parse(args[1]) : 100000;
+
+        // Warm up the pool so thread injection does not dominate the first data point
+        Run(1, itemsPerProducer);
+
+        Console.WriteLine("producers,items/s");
+        for (int producers = 1; producers <= maxThreads; producers *= 2)
+        {
+            Console.WriteLine("{0},{1:F0}", producers, Run(producers, itemsPerProducer));
+        }
+
+        return 100;
+    }
+}
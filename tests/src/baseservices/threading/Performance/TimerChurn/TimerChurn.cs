@@ -0,0 +1,63 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Creating and disposing timers that never fire, from a growing number of
+// threads, the pattern produced by per-request timeouts. Exercises the timer
+// queue lock and the native timer rescheduling path.
+//
+// Usage: TimerChurn [maxThreads] [timersPerThread]
+
+using System;
+using System.Diagnostics;
+using System.Threading;
+
+class TimerChurn
+{
+    static double Run(int threadCount, int timersPerThread)
+    {
+        TimerCallback callback = state => { throw new Exception("Timer should have been disposed before firing"); };
+
+        Thread[] threads = new Thread[threadCount];
+        Barrier start = new Barrier(threadCount + 1);
+        for (int i = 0; i < threadCount; i++)
+        {
+            threads[i] = new Thread(() =>
+            {
+                start.SignalAndWait();
+                for (int j = 0; j < timersPerThread; j++)
+                {
+                    // Vary the due time so new timers do not always land at the end of the queue
+                    using (new Timer(callback, null, 60000 + (j % 1000), Timeout.Infinite))
+                    {
+                    }
+                }
+            });
+            threads[i].Start();
+        }
+
+        start.SignalAndWait();
+        Stopwatch sw = Stopwatch.StartNew();
+        foreach (Thread t in threads)
+        {
+            t.Join();
+        }
+        sw.Stop();
+
+        return threadCount * (double)timersPerThread / sw.Elapsed.TotalSeconds;
+    }
+
+    static int Main(string[] args)
+    {
+        int maxThreads = (args.Length > 0) ? int.Parse(args[0]) : Math.Min(Environment.ProcessorCount, 128);
+        int timersPerThread = (args.Length > 1) ? int.Parse(args[1]) : 100000;
+
+        Console.WriteLine("threads,timers/s");
+        for (int threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            Console.WriteLine("{0},{1:F0}", threads, Run(threads, timersPerThread));
+        }
+
+        return 100;
+    }
+}